@@ -1,11 +1,62 @@
 #ifndef MIRAGE_BASE_AUTO_PTR_OWNED
 #define MIRAGE_BASE_AUTO_PTR_OWNED
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+
 namespace mirage::base {
 
-template <typename T>
+// Frees objects made by `Owned::New` or handed over as a raw pointer.
+struct HeapDelete {
+#if defined(MIRAGE_MEMORY_TRACKING)
+  // Size accounted by `New`, follows the object through conversions.
+  size_t tracked_size{0};
+#endif
+
+  template <typename T>
+  void operator()(T* ptr) const {
+#if defined(MIRAGE_MEMORY_TRACKING)
+    if (tracked_size != 0) {
+      MIRAGE_TRACK_DEALLOCATE(MemoryTag::kOwned, tracked_size);
+    }
+#endif
+    delete ptr;
+  }
+};
+
+// Frees objects made by `Owned::NewIn` in their allocator, with the size and
+// alignment of the type they were created as.
+struct AllocatorDelete {
+  Allocator* allocator{nullptr};
+  uint32_t size{0};
+  uint32_t align{0};
+
+  template <typename T>
+  void operator()(T* ptr) const {
+    MIRAGE_DCHECK(allocator != nullptr);
+    // The allocation starts at the complete object, which differs from `ptr`
+    // after a conversion to a base that is not the first.
+    void* base = nullptr;
+    if constexpr (std::is_polymorphic_v<T>) {
+      base = dynamic_cast<void*>(ptr);
+    } else {
+      base = ptr;
+    }
+    ptr->~T();
+    allocator->Deallocate(base, size, align);
+  }
+};
+
+// Unique owner of a `T`, freed by `D`. The default deleter is stateless, so
+// `Owned<T>` is as large as a raw pointer.
+template <typename T, typename D = HeapDelete>
 class Owned {
  public:
   Owned() = default;
@@ -24,14 +75,31 @@ class Owned {
   }
 
   template <typename... Args>
+    requires std::same_as<D, HeapDelete>
   static Owned New(Args&&... args) {
-    return Owned(new T(std::forward<Args>(args)...));
+    Owned owned(new T(std::forward<Args>(args)...));
+#if defined(MIRAGE_MEMORY_TRACKING)
+    MIRAGE_TRACK_ALLOCATE(MemoryTag::kOwned, sizeof(T));
+    owned.deleter_.tracked_size = sizeof(T);
+#endif
+    return owned;
   }
 
-  Owned(Owned&& other) noexcept : raw_ptr_(other.raw_ptr_) {
-    other.raw_ptr_ = nullptr;
+  // Constructs the object in memory from `allocator`, which must outlive the
+  // returned pointer and its conversions.
+  template <typename... Args>
+    requires std::same_as<D, AllocatorDelete>
+  static Owned NewIn(Allocator& allocator, Args&&... args) {
+    void* ptr = allocator.Allocate(sizeof(T), alignof(T));
+    return Owned(new (ptr) T(std::forward<Args>(args)...),
+                 AllocatorDelete{&allocator, static_cast<uint32_t>(sizeof(T)),
+                                 static_cast<uint32_t>(alignof(T))});
   }
 
+  Owned(Owned&& other) noexcept
+      : raw_ptr_(std::exchange(other.raw_ptr_, nullptr)),
+        deleter_(std::exchange(other.deleter_, D())) {}
+
   Owned& operator=(Owned&& other) noexcept {
     if (this != &other) {
       Reset();
@@ -41,29 +109,30 @@ class Owned {
   }
 
   void Reset() {
-    delete raw_ptr_;
-    raw_ptr_ = nullptr;
+    if (raw_ptr_ != nullptr) {
+      deleter_(raw_ptr_);
+      raw_ptr_ = nullptr;
+    }
+    deleter_ = D();
   }
 
-  template <typename T1>
+  template <typename T1, typename D1>
   friend class Owned;
 
   template <typename T1>
-  Owned<T1> TryConvert() {
+  Owned<T1, D> TryConvert() {
     T1* raw_ptr = dynamic_cast<T1*>(raw_ptr_);
     if (raw_ptr == nullptr) {
       return nullptr;
     }
-    Owned<T1> new_owned = Owned<T1>(raw_ptr);
     raw_ptr_ = nullptr;
-    return new_owned;
+    return Owned<T1, D>(raw_ptr, std::exchange(deleter_, D()));
   }
 
   template <typename T1>
-  Owned<T1> Convert() {
-    Owned<T1> new_owned = Owned<T1>(static_cast<T1*>(raw_ptr_));
-    raw_ptr_ = nullptr;
-    return new_owned;
+  Owned<T1, D> Convert() {
+    T1* raw_ptr = static_cast<T1*>(std::exchange(raw_ptr_, nullptr));
+    return Owned<T1, D>(raw_ptr, std::exchange(deleter_, D()));
   }
 
   T* operator->() const { return raw_ptr_; }
@@ -75,9 +144,16 @@ class Owned {
   [[nodiscard]] bool IsNull() const { return raw_ptr_ == nullptr; }
 
  private:
+  Owned(T* raw_ptr, D deleter) : raw_ptr_(raw_ptr), deleter_(deleter) {}
+
   T* raw_ptr_{nullptr};
+  [[no_unique_address]] D deleter_{};
 };
 
+// Owner of an object constructed in an `Allocator` by `NewIn`.
+template <typename T>
+using AllocatorOwned = Owned<T, AllocatorDelete>;
+
 }  // namespace mirage::base
 
 #endif  // MIRAGE_BASE_AUTO_PTR_OWNED
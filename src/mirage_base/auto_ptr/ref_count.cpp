@@ -45,3 +45,33 @@ bool RefCountAsync::TryRelease() {
   LockGuard lock(lock_);
   return RefCountLocal::TryRelease();
 }
+
+size_t RefCountAtomic::GetCnt() {
+  // Acquire pairs with the release in TryRelease, so an owner which observes
+  // itself as the only holder also observes all accesses of released holders.
+  return cnt_.load(std::memory_order_acquire);
+}
+
+void RefCountAtomic::Increase() {
+  cnt_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool RefCountAtomic::TryIncrease() {
+  size_t cnt = cnt_.load(std::memory_order_relaxed);
+  while (cnt != 0) {
+    if (cnt_.compare_exchange_weak(cnt, cnt + 1, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RefCountAtomic::TryRelease() {
+  size_t cnt = cnt_.load(std::memory_order_relaxed);
+  while (cnt != 0) {
+    if (cnt_.compare_exchange_weak(cnt, cnt - 1, std::memory_order_acq_rel)) {
+      return cnt == 1;
+    }
+  }
+  return true;
+}
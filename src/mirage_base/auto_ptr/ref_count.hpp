@@ -1,6 +1,7 @@
 #ifndef MIRAGE_BASE_AUTO_PTR_REF_COUNT
 #define MIRAGE_BASE_AUTO_PTR_REF_COUNT
 
+#include <atomic>
 #include <concepts>
 
 #include "mirage_base/define.hpp"
@@ -43,6 +44,19 @@ class MIRAGE_API RefCountAsync : public RefCountLocal {
   Lock lock_;
 };
 
+class MIRAGE_API RefCountAtomic : public RefCount {
+ public:
+  RefCountAtomic() = default;
+  ~RefCountAtomic() override = default;
+  size_t GetCnt() override;
+  void Increase() override;
+  bool TryIncrease() override;
+  bool TryRelease() override;
+
+ private:
+  std::atomic<size_t> cnt_{0};
+};
+
 template <typename R>
 concept AsRefCount =
     std::default_initializable<R> && std::derived_from<R, RefCount>;
@@ -1,22 +1,32 @@
 #ifndef MIRAGE_BASE_CONTAINER_ARRAY
 #define MIRAGE_BASE_CONTAINER_ARRAY
 
+#include <bit>
 #include <concepts>
 #include <initializer_list>
 #include <iterator>
 
 #include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
 #include "mirage_base/util/aligned_memory.hpp"
 
 namespace mirage::base {
 
-template <std::move_constructible T>
+// `ALIGN` raises the alignment of the buffer, e.g. to 32 or 64 bytes for
+// aligned vector loads. Elements stay densely packed.
+template <std::move_constructible T, size_t ALIGN = alignof(T)>
 class Array {
  public:
   class Iterator;
   class ConstIterator;
 
+  static_assert(std::has_single_bit(ALIGN) && ALIGN >= alignof(T));
+
   Array() = default;
+  // Takes storage from `allocator`, which must outlive the array. Copy
+  // construction uses the heap, copy assignment keeps the allocator of the
+  // target and moves keep the allocator of the source.
+  explicit Array(Allocator& allocator);
 
   Array(const Array& other)
     requires std::copy_constructible<T>;
@@ -56,6 +66,8 @@ class Array {
   [[nodiscard]] size_t GetCapacity() const;
   void SetCapacity(size_t capacity);
 
+  [[nodiscard]] Allocator& GetAllocator() const;
+
   Iterator begin();
   Iterator end();
 
@@ -65,13 +77,14 @@ class Array {
  private:
   void EnsureNotFull();
 
+  Allocator* allocator_{&HeapAllocator::Get(MemoryTag::kArray)};
   AlignedMemory<T>* data_{nullptr};
   size_t size_{0};
   size_t capacity_{0};
 };
 
-template <std::move_constructible T>
-class Array<T>::Iterator {
+template <std::move_constructible T, size_t A>
+class Array<T, A>::Iterator {
  public:
   using iterator_concept = std::contiguous_iterator_tag;
   using iterator_category = std::random_access_iterator_tag;
@@ -111,8 +124,8 @@ class Array<T>::Iterator {
   pointer ptr_{nullptr};
 };
 
-template <std::move_constructible T>
-class Array<T>::ConstIterator {
+template <std::move_constructible T, size_t A>
+class Array<T, A>::ConstIterator {
  public:
   using iterator_concept = std::contiguous_iterator_tag;
   using iterator_category = std::random_access_iterator_tag;
@@ -130,7 +143,7 @@ class Array<T>::ConstIterator {
   explicit ConstIterator(value_type* ptr);
 
   // NOLINTNEXTLINE: Convert to const
-  ConstIterator(const typename Array<T>::Iterator& iter);
+  ConstIterator(const typename Array<T, A>::Iterator& iter);
 
   reference operator*() const;
   pointer operator->() const;
@@ -151,8 +164,11 @@ class Array<T>::ConstIterator {
   pointer ptr_{nullptr};
 };
 
-template <std::move_constructible T>
-Array<T>::Array(const Array& other)
+template <std::move_constructible T, size_t A>
+Array<T, A>::Array(Allocator& allocator) : allocator_(&allocator) {}
+
+template <std::move_constructible T, size_t A>
+Array<T, A>::Array(const Array& other)
   requires std::copy_constructible<T>
 {
   Reserve(other.size_);
@@ -161,27 +177,33 @@ Array<T>::Array(const Array& other)
   }
 }
 
-template <std::move_constructible T>
-Array<T>& Array<T>::operator=(const Array& other)
+template <std::move_constructible T, size_t A>
+Array<T, A>& Array<T, A>::operator=(const Array& other)
   requires std::copy_constructible<T>
 {
   if (this != &other) {
     Clear();
-    new (this) Array(other);
+    Reserve(other.size_);
+    for (const T& val : other) {
+      Push(val);
+    }
   }
   return *this;
 }
 
-template <std::move_constructible T>
-Array<T>::Array(Array&& other) noexcept
-    : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+template <std::move_constructible T, size_t A>
+Array<T, A>::Array(Array&& other) noexcept
+    : allocator_(other.allocator_),
+      data_(other.data_),
+      size_(other.size_),
+      capacity_(other.capacity_) {
   other.size_ = 0;
   other.capacity_ = 0;
   other.data_ = nullptr;
 }
 
-template <std::move_constructible T>
-Array<T>& Array<T>::operator=(Array&& other) noexcept {
+template <std::move_constructible T, size_t A>
+Array<T, A>& Array<T, A>::operator=(Array&& other) noexcept {
   if (this != &other) {
     Clear();
     new (this) Array(std::move(other));
@@ -189,8 +211,8 @@ Array<T>& Array<T>::operator=(Array&& other) noexcept {
   return *this;
 }
 
-template <std::move_constructible T>
-Array<T>::Array(std::initializer_list<T> list)
+template <std::move_constructible T, size_t A>
+Array<T, A>::Array(std::initializer_list<T> list)
   requires std::copy_constructible<T>
 {
   Reserve(list.size());
@@ -199,59 +221,61 @@ Array<T>::Array(std::initializer_list<T> list)
   }
 }
 
-template <std::move_constructible T>
-Array<T>::~Array() noexcept {
+template <std::move_constructible T, size_t A>
+Array<T, A>::~Array() noexcept {
   Clear();
 }
 
-template <std::move_constructible T>
-void Array<T>::Clear() {
+template <std::move_constructible T, size_t A>
+void Array<T, A>::Clear() {
   for (size_t i = 0; i < size_; ++i) {
     data_[i].GetPtr()->~T();
   }
-  delete[] data_;
+  if (data_ != nullptr) {
+    allocator_->Deallocate(data_, capacity_ * sizeof(T), A);
+  }
   data_ = nullptr;
   size_ = 0;
   capacity_ = 0;
 }
 
-template <std::move_constructible T>
-void Array<T>::Push(const T& val)
+template <std::move_constructible T, size_t A>
+void Array<T, A>::Push(const T& val)
   requires std::copy_constructible<T>
 {
   Emplace(T(val));
 }
 
-template <std::move_constructible T>
+template <std::move_constructible T, size_t A>
 template <typename... Args>
-void Array<T>::Emplace(Args&&... args) {
+void Array<T, A>::Emplace(Args&&... args) {
   EnsureNotFull();
   new (data_[size_].GetPtr()) T(std::forward<Args>(args)...);
   ++size_;
 }
 
-template <std::move_constructible T>
-T Array<T>::Pop() {
+template <std::move_constructible T, size_t A>
+T Array<T, A>::Pop() {
   MIRAGE_DCHECK(size_ != 0);
   --size_;
   return std::move(data_[size_].GetRef());
 }
 
-template <std::move_constructible T>
-T& Array<T>::operator[](size_t index) const {
+template <std::move_constructible T, size_t A>
+T& Array<T, A>::operator[](size_t index) const {
   return data_[index].GetRef();
 }
 
-template <std::move_constructible T>
-T* Array<T>::TryGet(size_t index) const {
+template <std::move_constructible T, size_t A>
+T* Array<T, A>::TryGet(size_t index) const {
   if (index >= size_) {
     return nullptr;
   }
   return data_[index].GetPtr();
 }
 
-template <std::move_constructible T>
-bool Array<T>::operator==(const Array& other) const {
+template <std::move_constructible T, size_t A>
+bool Array<T, A>::operator==(const Array& other) const {
   if (size_ != other.size_) {
     return false;
   }
@@ -270,26 +294,26 @@ bool Array<T>::operator==(const Array& other) const {
   }
 }
 
-template <std::move_constructible T>
-void Array<T>::Reserve(const size_t capacity) {
+template <std::move_constructible T, size_t A>
+void Array<T, A>::Reserve(const size_t capacity) {
   if (capacity <= capacity_) {
     return;
   }
   SetCapacity(capacity);
 }
 
-template <std::move_constructible T>
-T* Array<T>::GetRawPtr() const {
+template <std::move_constructible T, size_t A>
+T* Array<T, A>::GetRawPtr() const {
   return reinterpret_cast<T*>(data_);
 }
 
-template <std::move_constructible T>
-size_t Array<T>::GetSize() const {
+template <std::move_constructible T, size_t A>
+size_t Array<T, A>::GetSize() const {
   return size_;
 }
 
-template <std::move_constructible T>
-void Array<T>::SetSize(const size_t size) {
+template <std::move_constructible T, size_t A>
+void Array<T, A>::SetSize(const size_t size) {
   if (size == size_) {
     return;
   }
@@ -312,74 +336,104 @@ void Array<T>::SetSize(const size_t size) {
   }
 }
 
-template <std::move_constructible T>
-bool Array<T>::IsEmpty() const {
+template <std::move_constructible T, size_t A>
+bool Array<T, A>::IsEmpty() const {
   return size_ == 0;
 }
 
-template <std::move_constructible T>
-size_t Array<T>::GetCapacity() const {
+template <std::move_constructible T, size_t A>
+size_t Array<T, A>::GetCapacity() const {
   return capacity_;
 }
 
-template <std::move_constructible T>
-void Array<T>::SetCapacity(const size_t capacity) {
+template <std::move_constructible T, size_t A>
+void Array<T, A>::SetCapacity(const size_t capacity) {
   if (capacity == capacity_) {
     return;
   }
+  if (capacity != 0 && capacity < capacity_) {
+    for (size_t i = capacity; i < size_; ++i) {
+      data_[i].GetPtr()->~T();
+    }
+    size_ = capacity < size_ ? capacity : size_;
+    if (allocator_->TryShrink(data_, capacity_ * sizeof(T),
+                              capacity * sizeof(T), A)) {
+      capacity_ = capacity;
+      return;
+    }
+  }
+  if (capacity > capacity_ && data_ != nullptr &&
+      allocator_->TryGrow(data_, capacity_ * sizeof(T), capacity * sizeof(T),
+                          A)) {
+    capacity_ = capacity;
+    return;
+  }
 
-  auto* data = new AlignedMemory<T>[capacity]();
+  AlignedMemory<T>* data = nullptr;
+  if (capacity != 0) {
+    data = static_cast<AlignedMemory<T>*>(
+        allocator_->Allocate(capacity * sizeof(T), A));
+  }
   const size_t size = capacity < size_ ? capacity : size_;
   for (size_t i = 0; i < size; ++i) {
     T* ptr = data_[i].GetPtr();
     new (data[i].GetPtr()) T(std::move(*ptr));
     ptr->~T();
   }
-  delete[] data_;
+  for (size_t i = size; i < size_; ++i) {
+    data_[i].GetPtr()->~T();
+  }
+  if (data_ != nullptr) {
+    allocator_->Deallocate(data_, capacity_ * sizeof(T), A);
+  }
 
   data_ = data;
   size_ = size;
   capacity_ = capacity;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator Array<T>::begin() {
+template <std::move_constructible T, size_t A>
+Allocator& Array<T, A>::GetAllocator() const {
+  return *allocator_;
+}
+
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator Array<T, A>::begin() {
   return Iterator(GetRawPtr());
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator Array<T>::end() {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator Array<T, A>::end() {
   return Iterator(GetRawPtr() + size_);
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator Array<T>::begin() const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator Array<T, A>::begin() const {
   return ConstIterator(GetRawPtr());
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator Array<T>::end() const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator Array<T, A>::end() const {
   return ConstIterator(GetRawPtr() + size_);
 }
 
-template <std::move_constructible T>
-void Array<T>::EnsureNotFull() {
+template <std::move_constructible T, size_t A>
+void Array<T, A>::EnsureNotFull() {
   if (capacity_ == 0) {
-    capacity_ = 1;
-    data_ = new AlignedMemory<T>[1]();
+    SetCapacity(1);
   } else if (size_ == capacity_) {
     SetCapacity(2 * capacity_);
   }
 }
 
-template <std::move_constructible T>
-Array<T>::Iterator::Iterator(const Iterator& other) : ptr_(other.ptr_) {}
+template <std::move_constructible T, size_t A>
+Array<T, A>::Iterator::Iterator(const Iterator& other) : ptr_(other.ptr_) {}
 
-template <std::move_constructible T>
-Array<T>::Iterator::Iterator(value_type* const ptr) : ptr_(ptr) {}
+template <std::move_constructible T, size_t A>
+Array<T, A>::Iterator::Iterator(value_type* const ptr) : ptr_(ptr) {}
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator=(
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type& Array<T, A>::Iterator::operator=(
     const iterator_type& other) {
   if (this != &other) {
     ptr_ = other.ptr_;
@@ -387,200 +441,206 @@ typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator=(
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator=(
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type& Array<T, A>::Iterator::operator=(
     std::nullptr_t) {
   ptr_ = nullptr;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::reference Array<T>::Iterator::operator*() const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::reference
+Array<T, A>::Iterator::operator*() const {
   return *ptr_;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::pointer Array<T>::Iterator::operator->() const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::pointer
+Array<T, A>::Iterator::operator->() const {
   return ptr_;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::reference Array<T>::Iterator::operator[](
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::reference Array<T, A>::Iterator::operator[](
     difference_type diff) const {
   return ptr_[diff];
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator++() {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type&
+Array<T, A>::Iterator::operator++() {
   if (ptr_ != nullptr) {
     ++ptr_;
   }
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type Array<T>::Iterator::operator++(int) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type
+Array<T, A>::Iterator::operator++(int) {
   iterator_type temp(*this);
   ++(*this);
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator--() {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type&
+Array<T, A>::Iterator::operator--() {
   --ptr_;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type Array<T>::Iterator::operator--(int) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type
+Array<T, A>::Iterator::operator--(int) {
   iterator_type temp(*this);
   --(*this);
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator+=(
-    difference_type diff) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type&
+Array<T, A>::Iterator::operator+=(difference_type diff) {
   ptr_ += diff;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type Array<T>::Iterator::operator+(
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type Array<T, A>::Iterator::operator+(
     difference_type diff) const {
   iterator_type temp(*this);
   temp += diff;
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type operator+(
-    ptrdiff_t diff, const typename Array<T>::Iterator::iterator_type& iter) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type operator+(
+    ptrdiff_t diff, const typename Array<T, A>::Iterator::iterator_type& iter) {
   return iter + diff;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type& Array<T>::Iterator::operator-=(
-    difference_type diff) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type&
+Array<T, A>::Iterator::operator-=(difference_type diff) {
   ptr_ -= diff;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::iterator_type Array<T>::Iterator::operator-(
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::iterator_type Array<T, A>::Iterator::operator-(
     difference_type diff) const {
   iterator_type temp(*this);
   temp -= diff;
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::Iterator::difference_type Array<T>::Iterator::operator-(
-    const iterator_type& other) const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::Iterator::difference_type
+Array<T, A>::Iterator::operator-(const iterator_type& other) const {
   return ptr_ - other.ptr_;
 }
 
-template <std::move_constructible T>
-Array<T>::ConstIterator::ConstIterator(const ConstIterator& other)
+template <std::move_constructible T, size_t A>
+Array<T, A>::ConstIterator::ConstIterator(const ConstIterator& other)
     : ptr_(other.ptr_) {}
 
-template <std::move_constructible T>
-Array<T>::ConstIterator::ConstIterator(const Iterator& iter)
+template <std::move_constructible T, size_t A>
+Array<T, A>::ConstIterator::ConstIterator(const Iterator& iter)
     : ptr_(iter.ptr_) {}
 
-template <std::move_constructible T>
-Array<T>::ConstIterator::ConstIterator(value_type* const ptr) : ptr_(ptr) {}
+template <std::move_constructible T, size_t A>
+Array<T, A>::ConstIterator::ConstIterator(value_type* const ptr) : ptr_(ptr) {}
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::reference Array<T>::ConstIterator::operator*()
-    const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::reference
+Array<T, A>::ConstIterator::operator*() const {
   return *ptr_;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::pointer Array<T>::ConstIterator::operator->()
-    const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::pointer
+Array<T, A>::ConstIterator::operator->() const {
   return ptr_;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::reference Array<T>::ConstIterator::operator[](
-    difference_type diff) const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::reference
+Array<T, A>::ConstIterator::operator[](difference_type diff) const {
   return ptr_[diff];
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type&
-Array<T>::ConstIterator::operator++() {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type&
+Array<T, A>::ConstIterator::operator++() {
   if (ptr_ != nullptr) {
     ++ptr_;
   }
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type
-Array<T>::ConstIterator::operator++(int) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type
+Array<T, A>::ConstIterator::operator++(int) {
   iterator_type temp(*this);
   ++(*this);
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type&
-Array<T>::ConstIterator::operator--() {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type&
+Array<T, A>::ConstIterator::operator--() {
   --ptr_;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type
-Array<T>::ConstIterator::operator--(int) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type
+Array<T, A>::ConstIterator::operator--(int) {
   iterator_type temp(*this);
   --(*this);
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type&
-Array<T>::ConstIterator::operator+=(difference_type diff) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type&
+Array<T, A>::ConstIterator::operator+=(difference_type diff) {
   ptr_ += diff;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type
-Array<T>::ConstIterator::operator+(difference_type diff) const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type
+Array<T, A>::ConstIterator::operator+(difference_type diff) const {
   iterator_type temp(*this);
   temp += diff;
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type operator+(
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type operator+(
     ptrdiff_t diff,
-    const typename Array<T>::ConstIterator::iterator_type& iter) {
+    const typename Array<T, A>::ConstIterator::iterator_type& iter) {
   return iter + diff;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type&
-Array<T>::ConstIterator::operator-=(difference_type diff) {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type&
+Array<T, A>::ConstIterator::operator-=(difference_type diff) {
   ptr_ -= diff;
   return *this;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::iterator_type
-Array<T>::ConstIterator::operator-(difference_type diff) const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::iterator_type
+Array<T, A>::ConstIterator::operator-(difference_type diff) const {
   iterator_type temp(*this);
   temp -= diff;
   return temp;
 }
 
-template <std::move_constructible T>
-typename Array<T>::ConstIterator::difference_type
-Array<T>::ConstIterator::operator-(const iterator_type& other) const {
+template <std::move_constructible T, size_t A>
+typename Array<T, A>::ConstIterator::difference_type
+Array<T, A>::ConstIterator::operator-(const iterator_type& other) const {
   return ptr_ - other.ptr_;
 }
 
@@ -0,0 +1,195 @@
+#include "mirage_base/container/bit_array.hpp"
+
+using namespace mirage::base;
+
+BitArray::BitArray(const size_t size) {
+  SetSize(size);
+}
+
+BitArray::BitArray(BitArray&& other) noexcept
+    : words_(std::move(other.words_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+BitArray& BitArray::operator=(BitArray&& other) noexcept {
+  if (this != &other) {
+    words_ = std::move(other.words_);
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+void BitArray::Clear() {
+  words_.Clear();
+  size_ = 0;
+}
+
+void BitArray::Push(const bool val) {
+  if (size_ % kWordBits == 0) {
+    words_.Push(0);
+  }
+  ++size_;
+  if (val) {
+    Set(size_ - 1);
+  }
+}
+
+void BitArray::Set(const size_t index) {
+  MIRAGE_DCHECK(index < size_);
+  words_[index / kWordBits] |= uint64_t(1) << (index % kWordBits);
+}
+
+void BitArray::Reset(const size_t index) {
+  MIRAGE_DCHECK(index < size_);
+  words_[index / kWordBits] &= ~(uint64_t(1) << (index % kWordBits));
+}
+
+void BitArray::Flip(const size_t index) {
+  MIRAGE_DCHECK(index < size_);
+  words_[index / kWordBits] ^= uint64_t(1) << (index % kWordBits);
+}
+
+bool BitArray::Test(const size_t index) const {
+  MIRAGE_DCHECK(index < size_);
+  return (words_[index / kWordBits] >> (index % kWordBits) & 1) != 0;
+}
+
+void BitArray::SetAll() {
+  uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    words[i] = ~uint64_t(0);
+  }
+  ClearTail();
+}
+
+void BitArray::ResetAll() {
+  uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    words[i] = 0;
+  }
+}
+
+size_t BitArray::PopCount() const {
+  const uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  size_t cnt = 0;
+  for (size_t i = 0; i < word_cnt; ++i) {
+    cnt += std::popcount(words[i]);
+  }
+  return cnt;
+}
+
+size_t BitArray::FindFirstSet() const {
+  const uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    if (words[i] != 0) {
+      return i * kWordBits + std::countr_zero(words[i]);
+    }
+  }
+  return size_;
+}
+
+size_t BitArray::FindNextSet(const size_t index) const {
+  const size_t begin = index + 1;
+  if (begin >= size_) {
+    return size_;
+  }
+  const uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  size_t i = begin / kWordBits;
+  // Drop the bits before `begin` in its word.
+  uint64_t word = words[i] & (~uint64_t(0) << (begin % kWordBits));
+  while (true) {
+    if (word != 0) {
+      return i * kWordBits + std::countr_zero(word);
+    }
+    if (++i == word_cnt) {
+      return size_;
+    }
+    word = words[i];
+  }
+}
+
+void BitArray::And(const BitArray& other) {
+  MIRAGE_DCHECK(size_ == other.size_);
+  uint64_t* dst = words_.GetRawPtr();
+  const uint64_t* src = other.words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    dst[i] &= src[i];
+  }
+}
+
+void BitArray::Or(const BitArray& other) {
+  MIRAGE_DCHECK(size_ == other.size_);
+  uint64_t* dst = words_.GetRawPtr();
+  const uint64_t* src = other.words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    dst[i] |= src[i];
+  }
+}
+
+void BitArray::Xor(const BitArray& other) {
+  MIRAGE_DCHECK(size_ == other.size_);
+  uint64_t* dst = words_.GetRawPtr();
+  const uint64_t* src = other.words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+void BitArray::AndNot(const BitArray& other) {
+  MIRAGE_DCHECK(size_ == other.size_);
+  uint64_t* dst = words_.GetRawPtr();
+  const uint64_t* src = other.words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    dst[i] &= ~src[i];
+  }
+}
+
+bool BitArray::operator==(const BitArray& other) const {
+  return size_ == other.size_ && words_ == other.words_;
+}
+
+void BitArray::Reserve(const size_t capacity) {
+  words_.Reserve(GetWordCnt(capacity));
+}
+
+size_t BitArray::GetSize() const {
+  return size_;
+}
+
+void BitArray::SetSize(const size_t size) {
+  words_.SetSize(GetWordCnt(size));
+  size_ = size;
+  ClearTail();
+}
+
+bool BitArray::IsEmpty() const {
+  return size_ == 0;
+}
+
+size_t BitArray::GetWordCnt() const {
+  return words_.GetSize();
+}
+
+uint64_t* BitArray::GetRawPtr() const {
+  return words_.GetRawPtr();
+}
+
+size_t BitArray::GetWordCnt(const size_t size) {
+  return (size + kWordBits - 1) / kWordBits;
+}
+
+void BitArray::ClearTail() {
+  if (const size_t tail = size_ % kWordBits; tail != 0) {
+    words_[words_.GetSize() - 1] &= (uint64_t(1) << tail) - 1;
+  }
+}
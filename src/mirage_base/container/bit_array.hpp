@@ -0,0 +1,91 @@
+#ifndef MIRAGE_BASE_CONTAINER_BIT_ARRAY
+#define MIRAGE_BASE_CONTAINER_BIT_ARRAY
+
+#include <bit>
+#include <cstdint>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Growable bitset packed into 64-bit words. Bits past `GetSize()` in the last
+// word are always kept zero, so word-wide operations never need masking on
+// read.
+class MIRAGE_API BitArray {
+ public:
+  BitArray() = default;
+  explicit BitArray(size_t size);
+
+  BitArray(const BitArray& other) = default;
+  BitArray& operator=(const BitArray& other) = default;
+
+  BitArray(BitArray&& other) noexcept;
+  BitArray& operator=(BitArray&& other) noexcept;
+
+  ~BitArray() = default;
+  void Clear();
+
+  void Push(bool val);
+
+  void Set(size_t index);
+  void Reset(size_t index);
+  void Flip(size_t index);
+  [[nodiscard]] bool Test(size_t index) const;
+
+  void SetAll();
+  void ResetAll();
+
+  [[nodiscard]] size_t PopCount() const;
+
+  // Returns `GetSize()` if there is no set bit.
+  [[nodiscard]] size_t FindFirstSet() const;
+  // Finds the first set bit after `index`, returns `GetSize()` if none.
+  [[nodiscard]] size_t FindNextSet(size_t index) const;
+
+  // Bitwise operations in place, both arrays must have the same size.
+  void And(const BitArray& other);
+  void Or(const BitArray& other);
+  void Xor(const BitArray& other);
+  void AndNot(const BitArray& other);
+
+  template <typename Fn>
+  void ForEachSetBit(Fn&& fn) const;
+
+  bool operator==(const BitArray& other) const;
+
+  void Reserve(size_t capacity);
+
+  [[nodiscard]] size_t GetSize() const;
+  void SetSize(size_t size);
+  [[nodiscard]] bool IsEmpty() const;
+
+  [[nodiscard]] size_t GetWordCnt() const;
+  uint64_t* GetRawPtr() const;
+
+ private:
+  static constexpr size_t kWordBits = 64;
+
+  static size_t GetWordCnt(size_t size);
+  void ClearTail();
+
+  Array<uint64_t> words_;
+  size_t size_{0};
+};
+
+template <typename Fn>
+void BitArray::ForEachSetBit(Fn&& fn) const {
+  const uint64_t* words = words_.GetRawPtr();
+  const size_t word_cnt = words_.GetSize();
+  for (size_t i = 0; i < word_cnt; ++i) {
+    uint64_t word = words[i];
+    while (word != 0) {
+      fn(i * kWordBits + std::countr_zero(word));
+      word &= word - 1;
+    }
+  }
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_BIT_ARRAY
@@ -0,0 +1,449 @@
+#ifndef MIRAGE_BASE_CONTAINER_CHUNKED_ARRAY
+#define MIRAGE_BASE_CONTAINER_CHUNKED_ARRAY
+
+#include <bit>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/util/aligned_memory.hpp"
+
+namespace mirage::base {
+
+// Segmented array which grows by appending fixed-size chunks. Elements are
+// never relocated, so pointers and references stay valid until the element is
+// removed. Only the chunk table grows by doubling, which moves pointers but
+// not elements.
+template <std::move_constructible T, size_t CHUNK_SIZE = 64>
+  requires(std::has_single_bit(CHUNK_SIZE))
+class ChunkedArray {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  ChunkedArray() = default;
+
+  ChunkedArray(const ChunkedArray& other)
+    requires std::copy_constructible<T>;
+  ChunkedArray& operator=(const ChunkedArray& other)
+    requires std::copy_constructible<T>;
+
+  ChunkedArray(ChunkedArray&& other) noexcept;
+  ChunkedArray& operator=(ChunkedArray&& other) noexcept;
+
+  ChunkedArray(std::initializer_list<T> list)
+    requires std::copy_constructible<T>;
+
+  ~ChunkedArray() noexcept;
+  void Clear();
+
+  void Push(const T& val)
+    requires std::copy_constructible<T>;
+
+  template <typename... Args>
+  T& Emplace(Args&&... args);
+
+  T Pop();
+
+  T& operator[](size_t index) const;
+  T* TryGet(size_t index) const;
+
+  void Reserve(size_t capacity);
+
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] size_t GetCapacity() const;
+
+  // Chunks are the unit of parallel work, every chunk except the last one is
+  // full.
+  [[nodiscard]] size_t GetChunkCnt() const;
+  Span<T> GetChunk(size_t chunk_index) const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  static constexpr size_t kShift = std::countr_zero(CHUNK_SIZE);
+  static constexpr size_t kMask = CHUNK_SIZE - 1;
+
+  T* GetPtr(size_t index) const;
+
+  static AlignedMemory<T>* NewChunk();
+  static void DeleteChunk(AlignedMemory<T>* chunk);
+
+  Array<AlignedMemory<T>*> chunks_;
+  size_t size_{0};
+};
+
+template <std::move_constructible T, size_t CHUNK_SIZE>
+  requires(std::has_single_bit(CHUNK_SIZE))
+class ChunkedArray<T, CHUNK_SIZE>::Iterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = Iterator;
+  using difference_type = ptrdiff_t;
+  using value_type = T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  Iterator() = default;
+  ~Iterator() = default;
+
+  Iterator(const Iterator& other) = default;
+  Iterator(const ChunkedArray* array, size_t index);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  friend class ConstIterator;
+
+  const ChunkedArray* array_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t CHUNK_SIZE>
+  requires(std::has_single_bit(CHUNK_SIZE))
+class ChunkedArray<T, CHUNK_SIZE>::ConstIterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = ConstIterator;
+  using difference_type = ptrdiff_t;
+  using value_type = const T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  ConstIterator() = default;
+  ~ConstIterator() = default;
+
+  ConstIterator(const ConstIterator& other) = default;
+  ConstIterator(const ChunkedArray* array, size_t index);
+
+  // NOLINTNEXTLINE: Convert to const
+  ConstIterator(const Iterator& iter);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  const ChunkedArray* array_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::ChunkedArray(const ChunkedArray& other)
+  requires std::copy_constructible<T>
+{
+  Reserve(other.size_);
+  for (const T& val : other) {
+    Push(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>& ChunkedArray<T, N>::operator=(const ChunkedArray& other)
+  requires std::copy_constructible<T>
+{
+  if (this != &other) {
+    Clear();
+    new (this) ChunkedArray(other);
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::ChunkedArray(ChunkedArray&& other) noexcept
+    : chunks_(std::move(other.chunks_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>& ChunkedArray<T, N>::operator=(
+    ChunkedArray&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    new (this) ChunkedArray(std::move(other));
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::ChunkedArray(std::initializer_list<T> list)
+  requires std::copy_constructible<T>
+{
+  Reserve(list.size());
+  for (const T& val : list) {
+    Push(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::~ChunkedArray() noexcept {
+  Clear();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+void ChunkedArray<T, N>::Clear() {
+  for (size_t i = 0; i < size_; ++i) {
+    GetPtr(i)->~T();
+  }
+  for (AlignedMemory<T>* chunk : chunks_) {
+    DeleteChunk(chunk);
+  }
+  chunks_.Clear();
+  size_ = 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+void ChunkedArray<T, N>::Push(const T& val)
+  requires std::copy_constructible<T>
+{
+  Emplace(T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+template <typename... Args>
+T& ChunkedArray<T, N>::Emplace(Args&&... args) {
+  if ((size_ >> kShift) == chunks_.GetSize()) {
+    chunks_.Push(NewChunk());
+  }
+  T* ptr = new (GetPtr(size_)) T(std::forward<Args>(args)...);
+  ++size_;
+  return *ptr;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+T ChunkedArray<T, N>::Pop() {
+  MIRAGE_DCHECK(size_ != 0);
+  --size_;
+  T* ptr = GetPtr(size_);
+  T val(std::move(*ptr));
+  ptr->~T();
+  return val;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+T& ChunkedArray<T, N>::operator[](const size_t index) const {
+  return *GetPtr(index);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+T* ChunkedArray<T, N>::TryGet(const size_t index) const {
+  if (index >= size_) {
+    return nullptr;
+  }
+  return GetPtr(index);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+void ChunkedArray<T, N>::Reserve(const size_t capacity) {
+  const size_t chunk_cnt = (capacity + kMask) >> kShift;
+  chunks_.Reserve(chunk_cnt);
+  while (chunks_.GetSize() < chunk_cnt) {
+    chunks_.Push(NewChunk());
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+size_t ChunkedArray<T, N>::GetSize() const {
+  return size_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+bool ChunkedArray<T, N>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+size_t ChunkedArray<T, N>::GetCapacity() const {
+  return chunks_.GetSize() << kShift;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+size_t ChunkedArray<T, N>::GetChunkCnt() const {
+  return (size_ + kMask) >> kShift;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+Span<T> ChunkedArray<T, N>::GetChunk(const size_t chunk_index) const {
+  MIRAGE_DCHECK(chunk_index < GetChunkCnt());
+  const size_t begin = chunk_index << kShift;
+  const size_t rest = size_ - begin;
+  return {chunks_[chunk_index]->GetPtr(), rest < N ? rest : N};
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator ChunkedArray<T, N>::begin() {
+  return Iterator(this, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator ChunkedArray<T, N>::end() {
+  return Iterator(this, size_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator ChunkedArray<T, N>::begin() const {
+  return ConstIterator(this, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator ChunkedArray<T, N>::end() const {
+  return ConstIterator(this, size_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+T* ChunkedArray<T, N>::GetPtr(const size_t index) const {
+  return chunks_[index >> kShift][index & kMask].GetPtr();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+AlignedMemory<T>* ChunkedArray<T, N>::NewChunk() {
+  return static_cast<AlignedMemory<T>*>(
+      HeapAllocator::Get(MemoryTag::kArray)
+          .Allocate(N * sizeof(T), alignof(T)));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+void ChunkedArray<T, N>::DeleteChunk(AlignedMemory<T>* chunk) {
+  HeapAllocator::Get(MemoryTag::kArray)
+      .Deallocate(chunk, N * sizeof(T), alignof(T));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::Iterator::Iterator(const ChunkedArray* array,
+                                       const size_t index)
+    : array_(array), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator::reference
+ChunkedArray<T, N>::Iterator::operator*() const {
+  return *array_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator::pointer
+ChunkedArray<T, N>::Iterator::operator->() const {
+  return array_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator::iterator_type&
+ChunkedArray<T, N>::Iterator::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::Iterator::iterator_type
+ChunkedArray<T, N>::Iterator::operator++(int) {
+  iterator_type temp(*this);
+  ++index_;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+bool ChunkedArray<T, N>::Iterator::operator==(
+    const iterator_type& other) const {
+  return array_ == other.array_ && index_ == other.index_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::ConstIterator::ConstIterator(const ChunkedArray* array,
+                                                 const size_t index)
+    : array_(array), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+ChunkedArray<T, N>::ConstIterator::ConstIterator(const Iterator& iter)
+    : array_(iter.array_), index_(iter.index_) {}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator::reference
+ChunkedArray<T, N>::ConstIterator::operator*() const {
+  return *array_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator::pointer
+ChunkedArray<T, N>::ConstIterator::operator->() const {
+  return array_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator::iterator_type&
+ChunkedArray<T, N>::ConstIterator::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+typename ChunkedArray<T, N>::ConstIterator::iterator_type
+ChunkedArray<T, N>::ConstIterator::operator++(int) {
+  iterator_type temp(*this);
+  ++index_;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(std::has_single_bit(N))
+bool ChunkedArray<T, N>::ConstIterator::operator==(
+    const iterator_type& other) const {
+  return array_ == other.array_ && index_ == other.index_;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_CHUNKED_ARRAY
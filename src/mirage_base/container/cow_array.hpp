@@ -0,0 +1,231 @@
+#ifndef MIRAGE_BASE_CONTAINER_COW_ARRAY
+#define MIRAGE_BASE_CONTAINER_COW_ARRAY
+
+#include <concepts>
+#include <initializer_list>
+
+#include "mirage_base/auto_ptr/ref_count.hpp"
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Copy-on-write array. Copies share one reference counted buffer, so taking a
+// snapshot is O(1). The buffer is cloned on the first mutation while it is
+// shared, reads never clone.
+template <std::copy_constructible T, AsRefCount R = RefCountAtomic>
+class CowArray {
+ public:
+  using ConstIterator = typename Array<T>::ConstIterator;
+
+  CowArray() = default;
+
+  CowArray(const CowArray& other);
+  CowArray& operator=(const CowArray& other);
+
+  CowArray(CowArray&& other) noexcept;
+  CowArray& operator=(CowArray&& other) noexcept;
+
+  explicit CowArray(Array<T>&& array);
+  CowArray(std::initializer_list<T> list);
+
+  ~CowArray() noexcept;
+  void Clear();
+
+  void Push(const T& val);
+
+  template <typename... Args>
+  void Emplace(Args&&... args);
+
+  T Pop();
+
+  const T& operator[](size_t index) const;
+  const T* TryGet(size_t index) const;
+  const Array<T>& GetArray() const;
+
+  // Mutable accessors, which clone the buffer first if it's shared.
+  T& GetMut(size_t index);
+  Array<T>& GetMutArray();
+
+  bool operator==(const CowArray& other) const;
+
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] bool IsShared() const;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  struct Buffer {
+    R ref_cnt;
+    Array<T> array;
+
+    explicit Buffer(Array<T>&& array) : array(std::move(array)) {
+      ref_cnt.Increase();
+    }
+  };
+
+  static const Array<T>& GetEmptyArray();
+
+  void Release();
+  void MakeUnique();
+
+  Buffer* buffer_{nullptr};
+};
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>::CowArray(const CowArray& other) : buffer_(other.buffer_) {
+  if (buffer_ != nullptr) {
+    buffer_->ref_cnt.Increase();
+  }
+}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>& CowArray<T, R>::operator=(const CowArray& other) {
+  if (this != &other) {
+    Release();
+    new (this) CowArray(other);
+  }
+  return *this;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>::CowArray(CowArray&& other) noexcept : buffer_(other.buffer_) {
+  other.buffer_ = nullptr;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>& CowArray<T, R>::operator=(CowArray&& other) noexcept {
+  if (this != &other) {
+    Release();
+    new (this) CowArray(std::move(other));
+  }
+  return *this;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>::CowArray(Array<T>&& array)
+    : buffer_(new Buffer(std::move(array))) {}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>::CowArray(std::initializer_list<T> list)
+    : CowArray(Array<T>(list)) {}
+
+template <std::copy_constructible T, AsRefCount R>
+CowArray<T, R>::~CowArray() noexcept {
+  Release();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+void CowArray<T, R>::Clear() {
+  Release();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+void CowArray<T, R>::Push(const T& val) {
+  GetMutArray().Push(val);
+}
+
+template <std::copy_constructible T, AsRefCount R>
+template <typename... Args>
+void CowArray<T, R>::Emplace(Args&&... args) {
+  GetMutArray().Emplace(std::forward<Args>(args)...);
+}
+
+template <std::copy_constructible T, AsRefCount R>
+T CowArray<T, R>::Pop() {
+  return GetMutArray().Pop();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+const T& CowArray<T, R>::operator[](const size_t index) const {
+  return GetArray()[index];
+}
+
+template <std::copy_constructible T, AsRefCount R>
+const T* CowArray<T, R>::TryGet(const size_t index) const {
+  return GetArray().TryGet(index);
+}
+
+template <std::copy_constructible T, AsRefCount R>
+const Array<T>& CowArray<T, R>::GetArray() const {
+  if (buffer_ == nullptr) {
+    return GetEmptyArray();
+  }
+  return buffer_->array;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+T& CowArray<T, R>::GetMut(const size_t index) {
+  return GetMutArray()[index];
+}
+
+template <std::copy_constructible T, AsRefCount R>
+Array<T>& CowArray<T, R>::GetMutArray() {
+  MakeUnique();
+  return buffer_->array;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+bool CowArray<T, R>::operator==(const CowArray& other) const {
+  return GetArray() == other.GetArray();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+size_t CowArray<T, R>::GetSize() const {
+  return GetArray().GetSize();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+bool CowArray<T, R>::IsEmpty() const {
+  return GetArray().IsEmpty();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+bool CowArray<T, R>::IsShared() const {
+  return buffer_ != nullptr && buffer_->ref_cnt.GetCnt() > 1;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+typename CowArray<T, R>::ConstIterator CowArray<T, R>::begin() const {
+  return GetArray().begin();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+typename CowArray<T, R>::ConstIterator CowArray<T, R>::end() const {
+  return GetArray().end();
+}
+
+template <std::copy_constructible T, AsRefCount R>
+const Array<T>& CowArray<T, R>::GetEmptyArray() {
+  static const Array<T> empty;
+  return empty;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+void CowArray<T, R>::Release() {
+  if (buffer_ != nullptr && buffer_->ref_cnt.TryRelease()) {
+    delete buffer_;
+  }
+  buffer_ = nullptr;
+}
+
+template <std::copy_constructible T, AsRefCount R>
+void CowArray<T, R>::MakeUnique() {
+  if (buffer_ == nullptr) {
+    buffer_ = new Buffer(Array<T>());
+    return;
+  }
+  // Only holders can add references, so a count of 1 can't grow behind us.
+  if (buffer_->ref_cnt.GetCnt() == 1) {
+    return;
+  }
+  auto* buffer = new Buffer(Array<T>(buffer_->array));
+  Release();
+  buffer_ = buffer;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_COW_ARRAY
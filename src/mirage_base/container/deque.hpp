@@ -0,0 +1,571 @@
+#ifndef MIRAGE_BASE_CONTAINER_DEQUE
+#define MIRAGE_BASE_CONTAINER_DEQUE
+
+#include <bit>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+#include "mirage_base/util/aligned_memory.hpp"
+
+namespace mirage::base {
+
+// Circular buffer with a power-of-two capacity. When FIXED_CAPACITY is 0 the
+// buffer lives on heap and doubles when full, otherwise it is stored inline and
+// never allocates.
+template <std::move_constructible T, size_t FIXED_CAPACITY>
+  requires(FIXED_CAPACITY == 0 || std::has_single_bit(FIXED_CAPACITY))
+class DequeBase {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  // Elements in order are `head` followed by `tail`, `tail` is only non-empty
+  // when the elements wrap around the end of the buffer.
+  struct Spans {
+    Span<T> head;
+    Span<T> tail;
+  };
+
+  static constexpr bool kIsFixed = FIXED_CAPACITY != 0;
+
+  DequeBase() = default;
+
+  DequeBase(const DequeBase& other)
+    requires std::copy_constructible<T>;
+  DequeBase& operator=(const DequeBase& other)
+    requires std::copy_constructible<T>;
+
+  DequeBase(DequeBase&& other) noexcept;
+  DequeBase& operator=(DequeBase&& other) noexcept;
+
+  DequeBase(std::initializer_list<T> list)
+    requires std::copy_constructible<T>;
+
+  ~DequeBase() noexcept;
+  void Clear();
+
+  void PushBack(const T& val)
+    requires std::copy_constructible<T>;
+  void PushFront(const T& val)
+    requires std::copy_constructible<T>;
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+  template <typename... Args>
+  void EmplaceFront(Args&&... args);
+
+  T PopBack();
+  T PopFront();
+
+  T& operator[](size_t index) const;
+  T* TryGet(size_t index) const;
+
+  T& GetFront() const;
+  T& GetBack() const;
+
+  Spans GetSpans() const;
+
+  void Reserve(size_t capacity)
+    requires(!kIsFixed);
+
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] bool IsFull() const;
+  [[nodiscard]] size_t GetCapacity() const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  using Storage = std::conditional_t<
+      kIsFixed, AlignedMemory<T>[kIsFixed ? FIXED_CAPACITY : 1],
+      AlignedMemory<T>*>;
+
+  T* GetPtr(size_t index) const;
+  void SetCapacity(size_t capacity)
+    requires(!kIsFixed);
+  void EnsureNotFull();
+
+  static AlignedMemory<T>* AllocateData(size_t capacity);
+  static void DeallocateData(AlignedMemory<T>* data, size_t capacity);
+
+  Storage data_{};
+  size_t head_{0};
+  size_t size_{0};
+  size_t capacity_{FIXED_CAPACITY};
+};
+
+template <std::move_constructible T, size_t FIXED_CAPACITY>
+  requires(FIXED_CAPACITY == 0 || std::has_single_bit(FIXED_CAPACITY))
+class DequeBase<T, FIXED_CAPACITY>::Iterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = Iterator;
+  using difference_type = ptrdiff_t;
+  using value_type = T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  Iterator() = default;
+  ~Iterator() = default;
+
+  Iterator(const Iterator& other) = default;
+  Iterator(const DequeBase* deque, size_t index);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  friend class ConstIterator;
+
+  const DequeBase* deque_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t FIXED_CAPACITY>
+  requires(FIXED_CAPACITY == 0 || std::has_single_bit(FIXED_CAPACITY))
+class DequeBase<T, FIXED_CAPACITY>::ConstIterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = ConstIterator;
+  using difference_type = ptrdiff_t;
+  using value_type = const T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  ConstIterator() = default;
+  ~ConstIterator() = default;
+
+  ConstIterator(const ConstIterator& other) = default;
+  ConstIterator(const DequeBase* deque, size_t index);
+
+  // NOLINTNEXTLINE: Convert to const
+  ConstIterator(const Iterator& iter);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  const DequeBase* deque_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::DequeBase(const DequeBase& other)
+  requires std::copy_constructible<T>
+{
+  if constexpr (!kIsFixed) {
+    Reserve(other.size_);
+  }
+  for (const T& val : other) {
+    PushBack(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>& DequeBase<T, N>::operator=(const DequeBase& other)
+  requires std::copy_constructible<T>
+{
+  if (this != &other) {
+    Clear();
+    new (this) DequeBase(other);
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::DequeBase(DequeBase&& other) noexcept {
+  if constexpr (kIsFixed) {
+    while (!other.IsEmpty()) {
+      EmplaceBack(other.PopFront());
+    }
+  } else {
+    data_ = other.data_;
+    head_ = other.head_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = nullptr;
+    other.head_ = 0;
+    other.size_ = 0;
+    other.capacity_ = 0;
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>& DequeBase<T, N>::operator=(DequeBase&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    new (this) DequeBase(std::move(other));
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::DequeBase(std::initializer_list<T> list)
+  requires std::copy_constructible<T>
+{
+  if constexpr (!kIsFixed) {
+    Reserve(list.size());
+  }
+  for (const T& val : list) {
+    PushBack(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::~DequeBase() noexcept {
+  Clear();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::Clear() {
+  for (size_t i = 0; i < size_; ++i) {
+    GetPtr(i)->~T();
+  }
+  head_ = 0;
+  size_ = 0;
+  if constexpr (!kIsFixed) {
+    DeallocateData(data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::PushBack(const T& val)
+  requires std::copy_constructible<T>
+{
+  EmplaceBack(T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::PushFront(const T& val)
+  requires std::copy_constructible<T>
+{
+  EmplaceFront(T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+template <typename... Args>
+void DequeBase<T, N>::EmplaceBack(Args&&... args) {
+  EnsureNotFull();
+  new (GetPtr(size_)) T(std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+template <typename... Args>
+void DequeBase<T, N>::EmplaceFront(Args&&... args) {
+  EnsureNotFull();
+  head_ = (head_ - 1) & (capacity_ - 1);
+  new (GetPtr(0)) T(std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T DequeBase<T, N>::PopBack() {
+  MIRAGE_DCHECK(size_ != 0);
+  --size_;
+  T* ptr = GetPtr(size_);
+  T val(std::move(*ptr));
+  ptr->~T();
+  return val;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T DequeBase<T, N>::PopFront() {
+  MIRAGE_DCHECK(size_ != 0);
+  T* ptr = GetPtr(0);
+  T val(std::move(*ptr));
+  ptr->~T();
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+  return val;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T& DequeBase<T, N>::operator[](const size_t index) const {
+  return *GetPtr(index);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T* DequeBase<T, N>::TryGet(const size_t index) const {
+  if (index >= size_) {
+    return nullptr;
+  }
+  return GetPtr(index);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T& DequeBase<T, N>::GetFront() const {
+  MIRAGE_DCHECK(size_ != 0);
+  return *GetPtr(0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T& DequeBase<T, N>::GetBack() const {
+  MIRAGE_DCHECK(size_ != 0);
+  return *GetPtr(size_ - 1);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Spans DequeBase<T, N>::GetSpans() const {
+  if (size_ == 0) {
+    return {};
+  }
+  const size_t head_size =
+      head_ + size_ <= capacity_ ? size_ : capacity_ - head_;
+  T* base = const_cast<AlignedMemory<T>*>(&data_[0])->GetPtr();
+  return {{base + head_, head_size}, {base, size_ - head_size}};
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::Reserve(const size_t capacity)
+  requires(!kIsFixed)
+{
+  if (capacity <= capacity_) {
+    return;
+  }
+  SetCapacity(std::bit_ceil(capacity));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+size_t DequeBase<T, N>::GetSize() const {
+  return size_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+bool DequeBase<T, N>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+bool DequeBase<T, N>::IsFull() const {
+  return size_ == capacity_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+size_t DequeBase<T, N>::GetCapacity() const {
+  return capacity_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator DequeBase<T, N>::begin() {
+  return Iterator(this, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator DequeBase<T, N>::end() {
+  return Iterator(this, size_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator DequeBase<T, N>::begin() const {
+  return ConstIterator(this, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator DequeBase<T, N>::end() const {
+  return ConstIterator(this, size_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+T* DequeBase<T, N>::GetPtr(const size_t index) const {
+  const size_t pos = (head_ + index) & (capacity_ - 1);
+  return const_cast<AlignedMemory<T>&>(data_[pos]).GetPtr();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+AlignedMemory<T>* DequeBase<T, N>::AllocateData(const size_t capacity) {
+  return static_cast<AlignedMemory<T>*>(
+      HeapAllocator::Get(MemoryTag::kArray)
+          .Allocate(capacity * sizeof(T), alignof(T)));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::DeallocateData(AlignedMemory<T>* data,
+                                     const size_t capacity) {
+  if (data != nullptr) {
+    HeapAllocator::Get(MemoryTag::kArray)
+        .Deallocate(data, capacity * sizeof(T), alignof(T));
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::SetCapacity(const size_t capacity)
+  requires(!kIsFixed)
+{
+  AlignedMemory<T>* data = AllocateData(capacity);
+  for (size_t i = 0; i < size_; ++i) {
+    T* ptr = GetPtr(i);
+    new (data[i].GetPtr()) T(std::move(*ptr));
+    ptr->~T();
+  }
+  DeallocateData(data_, capacity_);
+
+  data_ = data;
+  head_ = 0;
+  capacity_ = capacity;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+void DequeBase<T, N>::EnsureNotFull() {
+  if constexpr (kIsFixed) {
+    MIRAGE_DCHECK(size_ != capacity_);
+  } else if (capacity_ == 0) {
+    SetCapacity(1);
+  } else if (size_ == capacity_) {
+    SetCapacity(2 * capacity_);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::Iterator::Iterator(const DequeBase* deque, const size_t index)
+    : deque_(deque), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator::reference
+DequeBase<T, N>::Iterator::operator*() const {
+  return *deque_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator::pointer
+DequeBase<T, N>::Iterator::operator->() const {
+  return deque_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator::iterator_type&
+DequeBase<T, N>::Iterator::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::Iterator::iterator_type
+DequeBase<T, N>::Iterator::operator++(int) {
+  iterator_type temp(*this);
+  ++index_;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+bool DequeBase<T, N>::Iterator::operator==(const iterator_type& other) const {
+  return deque_ == other.deque_ && index_ == other.index_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::ConstIterator::ConstIterator(const DequeBase* deque,
+                                              const size_t index)
+    : deque_(deque), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+DequeBase<T, N>::ConstIterator::ConstIterator(const Iterator& iter)
+    : deque_(iter.deque_), index_(iter.index_) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator::reference
+DequeBase<T, N>::ConstIterator::operator*() const {
+  return *deque_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator::pointer
+DequeBase<T, N>::ConstIterator::operator->() const {
+  return deque_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator::iterator_type&
+DequeBase<T, N>::ConstIterator::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+typename DequeBase<T, N>::ConstIterator::iterator_type
+DequeBase<T, N>::ConstIterator::operator++(int) {
+  iterator_type temp(*this);
+  ++index_;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N == 0 || std::has_single_bit(N))
+bool DequeBase<T, N>::ConstIterator::operator==(
+    const iterator_type& other) const {
+  return deque_ == other.deque_ && index_ == other.index_;
+}
+
+template <std::move_constructible T>
+using Deque = DequeBase<T, 0>;
+
+template <std::move_constructible T, size_t CAPACITY>
+using RingBuffer = DequeBase<T, CAPACITY>;
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_DEQUE
@@ -164,7 +164,7 @@ class HashMap {
 
  private:
   struct Bucket {
-    SinglyLinkedList<KVPair> list;
+    SinglyLinkedList<KVPair> list{HeapAllocator::Get(MemoryTag::kHashMap)};
     uint32_t size{0};
 
     Bucket() = default;
@@ -189,7 +189,7 @@ class HashMap {
   };
 
   Hash<Key> hasher_;
-  Array<Bucket> buckets_;
+  Array<Bucket> buckets_{HeapAllocator::Get(MemoryTag::kHashMap)};
   uint32_t max_bucket_size_{8};
   size_t size_{0};
 };
@@ -0,0 +1,891 @@
+#ifndef MIRAGE_BASE_CONTAINER_INTRUSIVE_LIST
+#define MIRAGE_BASE_CONTAINER_INTRUSIVE_LIST
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Hook embedded in objects that join an `IntrusiveList`. Copying an object
+// does not copy its links, and a linked hook unlinks itself on destruction.
+struct IntrusiveListHook {
+  IntrusiveListHook* prev{nullptr};
+  IntrusiveListHook* next{nullptr};
+
+  IntrusiveListHook() = default;
+  ~IntrusiveListHook();
+
+  IntrusiveListHook(const IntrusiveListHook&);
+  IntrusiveListHook& operator=(const IntrusiveListHook&);
+
+  [[nodiscard]] bool IsLinked() const;
+  void Unlink();
+};
+
+// Hook embedded in objects that join an `IntrusiveSList`. The owner must be
+// removed from the list before it is destroyed.
+struct IntrusiveSListHook {
+  IntrusiveSListHook* next{nullptr};
+
+  IntrusiveSListHook() = default;
+  ~IntrusiveSListHook() = default;
+
+  IntrusiveSListHook(const IntrusiveSListHook&);
+  IntrusiveSListHook& operator=(const IntrusiveSListHook&);
+};
+
+namespace intrusive_internal {
+
+// Recovers the owner of a hook from the member pointer, like `container_of`.
+template <typename T, typename Hook, Hook T::*HOOK>
+T* GetOwner(const Hook* hook) {
+  alignas(T) std::byte dummy[sizeof(T)];
+  const auto* base = reinterpret_cast<const T*>(dummy);
+  const ptrdiff_t offset = reinterpret_cast<const std::byte*>(&(base->*HOOK)) -
+                           reinterpret_cast<const std::byte*>(base);
+  return reinterpret_cast<T*>(
+      const_cast<std::byte*>(reinterpret_cast<const std::byte*>(hook)) -
+      offset);
+}
+
+}  // namespace intrusive_internal
+
+// Doubly linked list over objects that embed an `IntrusiveListHook`. The list
+// never allocates or owns its elements, any element can be unlinked in O(1),
+// and whole lists can be spliced by rewriting a few pointers.
+template <typename T, IntrusiveListHook T::*HOOK>
+class IntrusiveList {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  IntrusiveList();
+  ~IntrusiveList();
+
+  IntrusiveList(const IntrusiveList&) = delete;
+  IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+  IntrusiveList(IntrusiveList&& other) noexcept;
+  IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+  void PushFront(T& val);
+  void PushBack(T& val);
+  T* PopFront();
+  T* PopBack();
+
+  T* GetFront() const;
+  T* GetBack() const;
+
+  // Insert `val` before `pos`, where `pos` is already in this list.
+  static void InsertBefore(T& pos, T& val);
+  static void InsertAfter(T& pos, T& val);
+  // Unlink `val` from whatever list it is in.
+  static void Remove(T& val);
+  static bool IsLinked(const T& val);
+
+  // Move all elements of `other` to the back of this list.
+  void SpliceBack(IntrusiveList& other);
+  void SpliceFront(IntrusiveList& other);
+
+  // Unlinks all elements, which are not destructed.
+  void Clear();
+
+  [[nodiscard]] bool IsEmpty() const;
+  // Walks the whole list, O(n).
+  [[nodiscard]] size_t GetSize() const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  static T* ToOwner(const IntrusiveListHook* hook);
+  static void LinkBetween(IntrusiveListHook* hook, IntrusiveListHook* prev,
+                          IntrusiveListHook* next);
+
+  // Sentinel of the circular list, its `next` is the front.
+  IntrusiveListHook head_;
+};
+
+template <typename T, IntrusiveListHook T::*HOOK>
+class IntrusiveList<T, HOOK>::Iterator {
+ public:
+  using iterator_concept = std::bidirectional_iterator_tag;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using iterator_type = Iterator;
+  using difference_type = int64_t;
+  using value_type = T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  Iterator() = default;
+  ~Iterator() = default;
+
+  Iterator(const Iterator& other) = default;
+  iterator_type& operator=(const iterator_type& other) = default;
+
+  explicit Iterator(IntrusiveListHook* here);
+
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  iterator_type& operator--();
+  iterator_type operator--(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  friend class ConstIterator;
+
+  IntrusiveListHook* here_{nullptr};
+};
+
+template <typename T, IntrusiveListHook T::*HOOK>
+class IntrusiveList<T, HOOK>::ConstIterator {
+ public:
+  using iterator_concept = std::bidirectional_iterator_tag;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using iterator_type = ConstIterator;
+  using difference_type = int64_t;
+  using value_type = const T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  ConstIterator() = default;
+  ~ConstIterator() = default;
+
+  ConstIterator(const ConstIterator& other) = default;
+  iterator_type& operator=(const iterator_type& other) = default;
+
+  explicit ConstIterator(const IntrusiveListHook* here);
+
+  // NOLINTNEXTLINE: Convert to const
+  ConstIterator(const Iterator& iter);
+
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  iterator_type& operator--();
+  iterator_type operator--(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  const IntrusiveListHook* here_{nullptr};
+};
+
+// Singly linked list over objects that embed an `IntrusiveSListHook`. Keeps
+// both ends, so pushing to the back and splicing are O(1), while removal needs
+// the predecessor.
+template <typename T, IntrusiveSListHook T::*HOOK>
+class IntrusiveSList {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  IntrusiveSList() = default;
+  ~IntrusiveSList();
+
+  IntrusiveSList(const IntrusiveSList&) = delete;
+  IntrusiveSList& operator=(const IntrusiveSList&) = delete;
+
+  IntrusiveSList(IntrusiveSList&& other) noexcept;
+  IntrusiveSList& operator=(IntrusiveSList&& other) noexcept;
+
+  void PushFront(T& val);
+  void PushBack(T& val);
+  T* PopFront();
+
+  T* GetFront() const;
+  T* GetBack() const;
+
+  // `pos` must be in this list.
+  void InsertAfter(T& pos, T& val);
+  T* RemoveAfter(T& pos);
+
+  // Move all elements of `other` to the back of this list.
+  void SpliceBack(IntrusiveSList& other);
+  void SpliceFront(IntrusiveSList& other);
+
+  // Unlinks all elements, which are not destructed.
+  void Clear();
+
+  [[nodiscard]] bool IsEmpty() const;
+  // Walks the whole list, O(n).
+  [[nodiscard]] size_t GetSize() const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  static T* ToOwner(const IntrusiveSListHook* hook);
+
+  IntrusiveSListHook* head_{nullptr};
+  IntrusiveSListHook* tail_{nullptr};
+};
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+class IntrusiveSList<T, HOOK>::Iterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = Iterator;
+  using difference_type = int64_t;
+  using value_type = T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  Iterator() = default;
+  ~Iterator() = default;
+
+  Iterator(const Iterator& other) = default;
+  iterator_type& operator=(const iterator_type& other) = default;
+
+  explicit Iterator(IntrusiveSListHook* here);
+
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  friend class ConstIterator;
+
+  IntrusiveSListHook* here_{nullptr};
+};
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+class IntrusiveSList<T, HOOK>::ConstIterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = ConstIterator;
+  using difference_type = int64_t;
+  using value_type = const T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  ConstIterator() = default;
+  ~ConstIterator() = default;
+
+  ConstIterator(const ConstIterator& other) = default;
+  iterator_type& operator=(const iterator_type& other) = default;
+
+  explicit ConstIterator(const IntrusiveSListHook* here);
+
+  // NOLINTNEXTLINE: Convert to const
+  ConstIterator(const Iterator& iter);
+
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  const IntrusiveSListHook* here_{nullptr};
+};
+
+inline IntrusiveListHook::~IntrusiveListHook() {
+  Unlink();
+}
+
+inline IntrusiveListHook::IntrusiveListHook(const IntrusiveListHook&) {}
+
+inline IntrusiveListHook& IntrusiveListHook::operator=(
+    const IntrusiveListHook&) {
+  return *this;
+}
+
+inline bool IntrusiveListHook::IsLinked() const {
+  return next != nullptr;
+}
+
+inline void IntrusiveListHook::Unlink() {
+  if (!IsLinked()) {
+    return;
+  }
+  prev->next = next;
+  next->prev = prev;
+  prev = nullptr;
+  next = nullptr;
+}
+
+inline IntrusiveSListHook::IntrusiveSListHook(const IntrusiveSListHook&) {}
+
+inline IntrusiveSListHook& IntrusiveSListHook::operator=(
+    const IntrusiveSListHook&) {
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::IntrusiveList() {
+  head_.prev = &head_;
+  head_.next = &head_;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::~IntrusiveList() {
+  Clear();
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::IntrusiveList(IntrusiveList&& other) noexcept
+    : IntrusiveList() {
+  SpliceBack(other);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>& IntrusiveList<T, HOOK>::operator=(
+    IntrusiveList&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    SpliceBack(other);
+  }
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::PushFront(T& val) {
+  LinkBetween(&(val.*HOOK), &head_, head_.next);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::PushBack(T& val) {
+  LinkBetween(&(val.*HOOK), head_.prev, &head_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+T* IntrusiveList<T, HOOK>::PopFront() {
+  if (IsEmpty()) {
+    return nullptr;
+  }
+  IntrusiveListHook* hook = head_.next;
+  hook->Unlink();
+  return ToOwner(hook);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+T* IntrusiveList<T, HOOK>::PopBack() {
+  if (IsEmpty()) {
+    return nullptr;
+  }
+  IntrusiveListHook* hook = head_.prev;
+  hook->Unlink();
+  return ToOwner(hook);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+T* IntrusiveList<T, HOOK>::GetFront() const {
+  return IsEmpty() ? nullptr : ToOwner(head_.next);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+T* IntrusiveList<T, HOOK>::GetBack() const {
+  return IsEmpty() ? nullptr : ToOwner(head_.prev);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::InsertBefore(T& pos, T& val) {
+  IntrusiveListHook* pos_hook = &(pos.*HOOK);
+  MIRAGE_DCHECK(pos_hook->IsLinked());
+  LinkBetween(&(val.*HOOK), pos_hook->prev, pos_hook);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::InsertAfter(T& pos, T& val) {
+  IntrusiveListHook* pos_hook = &(pos.*HOOK);
+  MIRAGE_DCHECK(pos_hook->IsLinked());
+  LinkBetween(&(val.*HOOK), pos_hook, pos_hook->next);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::Remove(T& val) {
+  (val.*HOOK).Unlink();
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+bool IntrusiveList<T, HOOK>::IsLinked(const T& val) {
+  return (val.*HOOK).IsLinked();
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::SpliceBack(IntrusiveList& other) {
+  if (this == &other || other.IsEmpty()) {
+    return;
+  }
+  IntrusiveListHook* first = other.head_.next;
+  IntrusiveListHook* last = other.head_.prev;
+  other.head_.next = &other.head_;
+  other.head_.prev = &other.head_;
+
+  first->prev = head_.prev;
+  head_.prev->next = first;
+  last->next = &head_;
+  head_.prev = last;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::SpliceFront(IntrusiveList& other) {
+  if (this == &other || other.IsEmpty()) {
+    return;
+  }
+  IntrusiveListHook* first = other.head_.next;
+  IntrusiveListHook* last = other.head_.prev;
+  other.head_.next = &other.head_;
+  other.head_.prev = &other.head_;
+
+  last->next = head_.next;
+  head_.next->prev = last;
+  first->prev = &head_;
+  head_.next = first;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::Clear() {
+  IntrusiveListHook* hook = head_.next;
+  while (hook != &head_) {
+    IntrusiveListHook* next = hook->next;
+    hook->prev = nullptr;
+    hook->next = nullptr;
+    hook = next;
+  }
+  head_.prev = &head_;
+  head_.next = &head_;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+bool IntrusiveList<T, HOOK>::IsEmpty() const {
+  return head_.next == &head_;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+size_t IntrusiveList<T, HOOK>::GetSize() const {
+  size_t size = 0;
+  for (const IntrusiveListHook* hook = head_.next; hook != &head_;
+       hook = hook->next) {
+    ++size;
+  }
+  return size;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator IntrusiveList<T, HOOK>::begin() {
+  return Iterator(head_.next);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator IntrusiveList<T, HOOK>::end() {
+  return Iterator(&head_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator IntrusiveList<T, HOOK>::begin()
+    const {
+  return ConstIterator(head_.next);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator IntrusiveList<T, HOOK>::end()
+    const {
+  return ConstIterator(&head_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+T* IntrusiveList<T, HOOK>::ToOwner(const IntrusiveListHook* hook) {
+  return intrusive_internal::GetOwner<T, IntrusiveListHook, HOOK>(hook);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+void IntrusiveList<T, HOOK>::LinkBetween(IntrusiveListHook* hook,
+                                         IntrusiveListHook* prev,
+                                         IntrusiveListHook* next) {
+  MIRAGE_DCHECK(!hook->IsLinked());
+  hook->prev = prev;
+  hook->next = next;
+  prev->next = hook;
+  next->prev = hook;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::Iterator::Iterator(IntrusiveListHook* here)
+    : here_(here) {}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::reference
+IntrusiveList<T, HOOK>::Iterator::operator*() const {
+  return *ToOwner(here_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::pointer
+IntrusiveList<T, HOOK>::Iterator::operator->() const {
+  return ToOwner(here_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::iterator_type&
+IntrusiveList<T, HOOK>::Iterator::operator++() {
+  here_ = here_->next;
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::iterator_type
+IntrusiveList<T, HOOK>::Iterator::operator++(int) {
+  iterator_type temp = *this;
+  here_ = here_->next;
+  return temp;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::iterator_type&
+IntrusiveList<T, HOOK>::Iterator::operator--() {
+  here_ = here_->prev;
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::Iterator::iterator_type
+IntrusiveList<T, HOOK>::Iterator::operator--(int) {
+  iterator_type temp = *this;
+  here_ = here_->prev;
+  return temp;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+bool IntrusiveList<T, HOOK>::Iterator::operator==(
+    const iterator_type& other) const {
+  return here_ == other.here_;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::ConstIterator::ConstIterator(
+    const IntrusiveListHook* here)
+    : here_(here) {}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+IntrusiveList<T, HOOK>::ConstIterator::ConstIterator(const Iterator& iter)
+    : here_(iter.here_) {}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::reference
+IntrusiveList<T, HOOK>::ConstIterator::operator*() const {
+  return *ToOwner(here_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::pointer
+IntrusiveList<T, HOOK>::ConstIterator::operator->() const {
+  return ToOwner(here_);
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::iterator_type&
+IntrusiveList<T, HOOK>::ConstIterator::operator++() {
+  here_ = here_->next;
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::iterator_type
+IntrusiveList<T, HOOK>::ConstIterator::operator++(int) {
+  iterator_type temp = *this;
+  here_ = here_->next;
+  return temp;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::iterator_type&
+IntrusiveList<T, HOOK>::ConstIterator::operator--() {
+  here_ = here_->prev;
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+typename IntrusiveList<T, HOOK>::ConstIterator::iterator_type
+IntrusiveList<T, HOOK>::ConstIterator::operator--(int) {
+  iterator_type temp = *this;
+  here_ = here_->prev;
+  return temp;
+}
+
+template <typename T, IntrusiveListHook T::*HOOK>
+bool IntrusiveList<T, HOOK>::ConstIterator::operator==(
+    const iterator_type& other) const {
+  return here_ == other.here_;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>::~IntrusiveSList() {
+  Clear();
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>::IntrusiveSList(IntrusiveSList&& other) noexcept
+    : head_(other.head_), tail_(other.tail_) {
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>& IntrusiveSList<T, HOOK>::operator=(
+    IntrusiveSList&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    new (this) IntrusiveSList(std::move(other));
+  }
+  return *this;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::PushFront(T& val) {
+  IntrusiveSListHook* hook = &(val.*HOOK);
+  hook->next = head_;
+  head_ = hook;
+  if (tail_ == nullptr) {
+    tail_ = hook;
+  }
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::PushBack(T& val) {
+  IntrusiveSListHook* hook = &(val.*HOOK);
+  hook->next = nullptr;
+  if (tail_ == nullptr) {
+    head_ = hook;
+  } else {
+    tail_->next = hook;
+  }
+  tail_ = hook;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+T* IntrusiveSList<T, HOOK>::PopFront() {
+  if (head_ == nullptr) {
+    return nullptr;
+  }
+  IntrusiveSListHook* hook = head_;
+  head_ = hook->next;
+  if (head_ == nullptr) {
+    tail_ = nullptr;
+  }
+  hook->next = nullptr;
+  return ToOwner(hook);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+T* IntrusiveSList<T, HOOK>::GetFront() const {
+  return head_ == nullptr ? nullptr : ToOwner(head_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+T* IntrusiveSList<T, HOOK>::GetBack() const {
+  return tail_ == nullptr ? nullptr : ToOwner(tail_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::InsertAfter(T& pos, T& val) {
+  IntrusiveSListHook* pos_hook = &(pos.*HOOK);
+  IntrusiveSListHook* hook = &(val.*HOOK);
+  hook->next = pos_hook->next;
+  pos_hook->next = hook;
+  if (tail_ == pos_hook) {
+    tail_ = hook;
+  }
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+T* IntrusiveSList<T, HOOK>::RemoveAfter(T& pos) {
+  IntrusiveSListHook* pos_hook = &(pos.*HOOK);
+  IntrusiveSListHook* hook = pos_hook->next;
+  if (hook == nullptr) {
+    return nullptr;
+  }
+  pos_hook->next = hook->next;
+  if (tail_ == hook) {
+    tail_ = pos_hook;
+  }
+  hook->next = nullptr;
+  return ToOwner(hook);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::SpliceBack(IntrusiveSList& other) {
+  if (this == &other || other.head_ == nullptr) {
+    return;
+  }
+  if (tail_ == nullptr) {
+    head_ = other.head_;
+  } else {
+    tail_->next = other.head_;
+  }
+  tail_ = other.tail_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::SpliceFront(IntrusiveSList& other) {
+  if (this == &other || other.head_ == nullptr) {
+    return;
+  }
+  other.tail_->next = head_;
+  if (tail_ == nullptr) {
+    tail_ = other.tail_;
+  }
+  head_ = other.head_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+void IntrusiveSList<T, HOOK>::Clear() {
+  IntrusiveSListHook* hook = head_;
+  while (hook != nullptr) {
+    IntrusiveSListHook* next = hook->next;
+    hook->next = nullptr;
+    hook = next;
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+bool IntrusiveSList<T, HOOK>::IsEmpty() const {
+  return head_ == nullptr;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+size_t IntrusiveSList<T, HOOK>::GetSize() const {
+  size_t size = 0;
+  for (const IntrusiveSListHook* hook = head_; hook != nullptr;
+       hook = hook->next) {
+    ++size;
+  }
+  return size;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator IntrusiveSList<T, HOOK>::begin() {
+  return Iterator(head_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator IntrusiveSList<T, HOOK>::end() {
+  return Iterator();
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator
+IntrusiveSList<T, HOOK>::begin() const {
+  return ConstIterator(head_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator IntrusiveSList<T, HOOK>::end()
+    const {
+  return ConstIterator();
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+T* IntrusiveSList<T, HOOK>::ToOwner(const IntrusiveSListHook* hook) {
+  return intrusive_internal::GetOwner<T, IntrusiveSListHook, HOOK>(hook);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>::Iterator::Iterator(IntrusiveSListHook* here)
+    : here_(here) {}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator::reference
+IntrusiveSList<T, HOOK>::Iterator::operator*() const {
+  return *ToOwner(here_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator::pointer
+IntrusiveSList<T, HOOK>::Iterator::operator->() const {
+  return ToOwner(here_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator::iterator_type&
+IntrusiveSList<T, HOOK>::Iterator::operator++() {
+  if (here_ != nullptr) {
+    here_ = here_->next;
+  }
+  return *this;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::Iterator::iterator_type
+IntrusiveSList<T, HOOK>::Iterator::operator++(int) {
+  iterator_type temp = *this;
+  ++*this;
+  return temp;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+bool IntrusiveSList<T, HOOK>::Iterator::operator==(
+    const iterator_type& other) const {
+  return here_ == other.here_;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>::ConstIterator::ConstIterator(
+    const IntrusiveSListHook* here)
+    : here_(here) {}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+IntrusiveSList<T, HOOK>::ConstIterator::ConstIterator(const Iterator& iter)
+    : here_(iter.here_) {}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator::reference
+IntrusiveSList<T, HOOK>::ConstIterator::operator*() const {
+  return *ToOwner(here_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator::pointer
+IntrusiveSList<T, HOOK>::ConstIterator::operator->() const {
+  return ToOwner(here_);
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator::iterator_type&
+IntrusiveSList<T, HOOK>::ConstIterator::operator++() {
+  if (here_ != nullptr) {
+    here_ = here_->next;
+  }
+  return *this;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+typename IntrusiveSList<T, HOOK>::ConstIterator::iterator_type
+IntrusiveSList<T, HOOK>::ConstIterator::operator++(int) {
+  iterator_type temp = *this;
+  ++*this;
+  return temp;
+}
+
+template <typename T, IntrusiveSListHook T::*HOOK>
+bool IntrusiveSList<T, HOOK>::ConstIterator::operator==(
+    const iterator_type& other) const {
+  return here_ == other.here_;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_INTRUSIVE_LIST
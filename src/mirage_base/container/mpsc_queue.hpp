@@ -0,0 +1,145 @@
+#ifndef MIRAGE_BASE_CONTAINER_MPSC_QUEUE
+#define MIRAGE_BASE_CONTAINER_MPSC_QUEUE
+
+#include <atomic>
+#include <concepts>
+
+#include "mirage_base/container/singly_linked_list.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/util/optional.hpp"
+
+namespace mirage::base {
+
+// Lock-free multi-producer single-consumer FIFO queue over `SinglyLinkedList`
+// nodes. Producers publish a node with one CAS on the incoming stack. The
+// consumer detaches the whole incoming stack with one exchange and reverses it
+// into a private outgoing list, so the consumer never contends with producers
+// per element.
+template <std::move_constructible T>
+class MpscQueue {
+ public:
+  using Node = typename SinglyLinkedList<T>::Node;
+
+  MpscQueue() = default;
+  ~MpscQueue();
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+  MpscQueue(MpscQueue&&) = delete;
+  MpscQueue& operator=(MpscQueue&&) = delete;
+
+  // Safe to call from any thread.
+  template <typename... Args>
+  void Emplace(Args&&... args);
+  void Push(const T& val)
+    requires std::copy_constructible<T>;
+
+  // Consumer only.
+  Optional<T> TryPop();
+  // Consumer only. Takes every queued element in FIFO order.
+  SinglyLinkedList<T> PopAll();
+  // Consumer only. May miss elements pushed concurrently.
+  [[nodiscard]] bool IsEmpty() const;
+
+ private:
+  // Moves the incoming stack to the back of the outgoing list.
+  void TakeIncoming();
+  static void DeleteChain(Node* node);
+
+  std::atomic<Node*> incoming_{nullptr};
+  Node* outgoing_head_{nullptr};
+  Node* outgoing_tail_{nullptr};
+};
+
+template <std::move_constructible T>
+MpscQueue<T>::~MpscQueue() {
+  DeleteChain(outgoing_head_);
+  DeleteChain(incoming_.load(std::memory_order_acquire));
+}
+
+template <std::move_constructible T>
+template <typename... Args>
+void MpscQueue<T>::Emplace(Args&&... args) {
+  Node* node = SinglyLinkedList<T>::NewNode(std::forward<Args>(args)...);
+  Node* head = incoming_.load(std::memory_order_relaxed);
+  do {
+    node->next = head;
+  } while (!incoming_.compare_exchange_weak(
+      head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <std::move_constructible T>
+void MpscQueue<T>::Push(const T& val)
+  requires std::copy_constructible<T>
+{
+  Emplace(T(val));
+}
+
+template <std::move_constructible T>
+Optional<T> MpscQueue<T>::TryPop() {
+  if (outgoing_head_ == nullptr) {
+    TakeIncoming();
+    if (outgoing_head_ == nullptr) {
+      return Optional<T>::None();
+    }
+  }
+  Node* node = outgoing_head_;
+  outgoing_head_ = node->next;
+  if (outgoing_head_ == nullptr) {
+    outgoing_tail_ = nullptr;
+  }
+  Optional<T> val(std::move(node->val));
+  SinglyLinkedList<T>::DeleteNode(node);
+  return val;
+}
+
+template <std::move_constructible T>
+SinglyLinkedList<T> MpscQueue<T>::PopAll() {
+  TakeIncoming();
+  Node* head = outgoing_head_;
+  Node* tail = outgoing_tail_;
+  outgoing_head_ = nullptr;
+  outgoing_tail_ = nullptr;
+  return SinglyLinkedList<T>::FromNodes(head, tail);
+}
+
+template <std::move_constructible T>
+bool MpscQueue<T>::IsEmpty() const {
+  return outgoing_head_ == nullptr &&
+         incoming_.load(std::memory_order_relaxed) == nullptr;
+}
+
+template <std::move_constructible T>
+void MpscQueue<T>::TakeIncoming() {
+  Node* node = incoming_.exchange(nullptr, std::memory_order_acquire);
+  if (node == nullptr) {
+    return;
+  }
+  Node* reversed = nullptr;
+  Node* tail = node;
+  while (node != nullptr) {
+    Node* next = node->next;
+    node->next = reversed;
+    reversed = node;
+    node = next;
+  }
+  if (outgoing_tail_ == nullptr) {
+    outgoing_head_ = reversed;
+  } else {
+    outgoing_tail_->next = reversed;
+  }
+  outgoing_tail_ = tail;
+}
+
+template <std::move_constructible T>
+void MpscQueue<T>::DeleteChain(Node* node) {
+  while (node != nullptr) {
+    Node* next = node->next;
+    SinglyLinkedList<T>::DeleteNode(node);
+    node = next;
+  }
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_MPSC_QUEUE
@@ -0,0 +1,123 @@
+#include "mirage_base/container/packed_int_array.hpp"
+
+#include <bit>
+
+using namespace mirage::base;
+
+BlockPackedArray::BlockPackedArray(BlockPackedArray&& other) noexcept
+    : blocks_(std::move(other.blocks_)),
+      words_(std::move(other.words_)),
+      pending_(std::move(other.pending_)),
+      size_(other.size_) {
+  other.size_ = 0;
+}
+
+BlockPackedArray& BlockPackedArray::operator=(
+    BlockPackedArray&& other) noexcept {
+  if (this != &other) {
+    blocks_ = std::move(other.blocks_);
+    words_ = std::move(other.words_);
+    pending_ = std::move(other.pending_);
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+void BlockPackedArray::Clear() {
+  blocks_.Clear();
+  words_.Clear();
+  pending_.Clear();
+  size_ = 0;
+}
+
+void BlockPackedArray::Push(const uint64_t val) {
+  pending_.Push(val);
+  ++size_;
+  if (pending_.GetSize() == kBlockSize) {
+    SealPending();
+  }
+}
+
+uint64_t BlockPackedArray::Get(const size_t index) const {
+  MIRAGE_DCHECK(index < size_);
+  const size_t block_index = index / kBlockSize;
+  const size_t offset = index % kBlockSize;
+  if (block_index == blocks_.GetSize()) {
+    return pending_[offset];
+  }
+  const Block& block = blocks_[block_index];
+  if (block.bits == 0) {
+    return block.base;
+  }
+  return block.base +
+         packed_int_internal::Read(words_.GetRawPtr() + block.word_offset,
+                                   offset * block.bits, block.bits);
+}
+
+size_t BlockPackedArray::GetBlockCnt() const {
+  return (size_ + kBlockSize - 1) / kBlockSize;
+}
+
+size_t BlockPackedArray::DecodeBlock(const size_t block_index,
+                                     uint64_t* out) const {
+  MIRAGE_DCHECK(block_index < GetBlockCnt());
+  if (block_index == blocks_.GetSize()) {
+    const size_t cnt = pending_.GetSize();
+    for (size_t i = 0; i < cnt; ++i) {
+      out[i] = pending_[i];
+    }
+    return cnt;
+  }
+
+  const Block& block = blocks_[block_index];
+  const uint64_t base = block.base;
+  const uint32_t bits = block.bits;
+  if (bits == 0) {
+    for (size_t i = 0; i < kBlockSize; ++i) {
+      out[i] = base;
+    }
+    return kBlockSize;
+  }
+  // The width is fixed for the whole block, so this loop has no data
+  // dependent branches and can be vectorized.
+  const uint64_t* words = words_.GetRawPtr() + block.word_offset;
+  for (size_t i = 0; i < kBlockSize; ++i) {
+    out[i] = base + packed_int_internal::Read(words, i * bits, bits);
+  }
+  return kBlockSize;
+}
+
+size_t BlockPackedArray::GetSize() const {
+  return size_;
+}
+
+bool BlockPackedArray::IsEmpty() const {
+  return size_ == 0;
+}
+
+size_t BlockPackedArray::GetMemorySize() const {
+  return blocks_.GetSize() * sizeof(Block) +
+         words_.GetSize() * sizeof(uint64_t) +
+         pending_.GetSize() * sizeof(uint64_t);
+}
+
+void BlockPackedArray::SealPending() {
+  uint64_t min = pending_[0];
+  uint64_t max = pending_[0];
+  for (const uint64_t val : pending_) {
+    min = val < min ? val : min;
+    max = val > max ? val : max;
+  }
+
+  const auto bits = static_cast<uint32_t>(std::bit_width(max - min));
+  const size_t word_offset = words_.GetSize();
+  // kBlockSize values take exactly `2 * bits` words.
+  words_.SetSize(word_offset + kBlockSize * bits / 64);
+  uint64_t* words = words_.GetRawPtr() + word_offset;
+  for (size_t i = 0; i < kBlockSize && bits != 0; ++i) {
+    packed_int_internal::Write(words, i * bits, bits, pending_[i] - min);
+  }
+  blocks_.Push({min, word_offset, bits});
+  pending_.SetSize(0);
+}
@@ -0,0 +1,229 @@
+#ifndef MIRAGE_BASE_CONTAINER_PACKED_INT_ARRAY
+#define MIRAGE_BASE_CONTAINER_PACKED_INT_ARRAY
+
+#include <cstdint>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+namespace packed_int_internal {
+
+constexpr uint64_t GetMask(const uint32_t bits) {
+  return bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+}
+
+// Reads `bits` wide value starting at `bit_pos`, which may cross a word.
+inline uint64_t Read(const uint64_t* words, const size_t bit_pos,
+                     const uint32_t bits) {
+  const size_t index = bit_pos / 64;
+  const size_t shift = bit_pos % 64;
+  uint64_t val = words[index] >> shift;
+  if (shift + bits > 64) {
+    val |= words[index + 1] << (64 - shift);
+  }
+  return val & GetMask(bits);
+}
+
+// Words must be zero-initialized, or hold this value, before writing.
+inline void Write(uint64_t* words, const size_t bit_pos, const uint32_t bits,
+                  const uint64_t val) {
+  const size_t index = bit_pos / 64;
+  const size_t shift = bit_pos % 64;
+  const uint64_t mask = GetMask(bits);
+  words[index] = (words[index] & ~(mask << shift)) | ((val & mask) << shift);
+  if (shift + bits > 64) {
+    const size_t rest = 64 - shift;
+    words[index + 1] =
+        (words[index + 1] & ~(mask >> rest)) | ((val & mask) >> rest);
+  }
+}
+
+}  // namespace packed_int_internal
+
+// Unsigned integers packed into `BITS` bits each. Values wider than `BITS`
+// are truncated on write.
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+class PackedIntArray {
+ public:
+  PackedIntArray() = default;
+  ~PackedIntArray() = default;
+
+  PackedIntArray(const PackedIntArray& other) = default;
+  PackedIntArray& operator=(const PackedIntArray& other) = default;
+
+  PackedIntArray(PackedIntArray&& other) noexcept;
+  PackedIntArray& operator=(PackedIntArray&& other) noexcept;
+
+  void Clear();
+
+  void Push(uint64_t val);
+
+  [[nodiscard]] uint64_t Get(size_t index) const;
+  void Set(size_t index, uint64_t val);
+
+  void Reserve(size_t capacity);
+
+  [[nodiscard]] size_t GetSize() const;
+  void SetSize(size_t size);
+  [[nodiscard]] bool IsEmpty() const;
+
+  [[nodiscard]] size_t GetWordCnt() const;
+
+ private:
+  static size_t GetWordCnt(size_t size);
+
+  Array<uint64_t> words_;
+  size_t size_{0};
+};
+
+// Append-only array of unsigned integers compressed with frame of reference
+// in blocks of `kBlockSize` values. Each block stores its minimum and packs
+// the offsets from it with the fewest bits, so clustered or monotonic values
+// such as ids and timestamps shrink to a few bits each. Random access is O(1),
+// and whole blocks can be decoded at once. The last, incomplete block is kept
+// uncompressed until it is full.
+class MIRAGE_API BlockPackedArray {
+ public:
+  static constexpr size_t kBlockSize = 128;
+
+  BlockPackedArray() = default;
+  ~BlockPackedArray() = default;
+
+  BlockPackedArray(const BlockPackedArray& other) = default;
+  BlockPackedArray& operator=(const BlockPackedArray& other) = default;
+
+  BlockPackedArray(BlockPackedArray&& other) noexcept;
+  BlockPackedArray& operator=(BlockPackedArray&& other) noexcept;
+
+  void Clear();
+
+  void Push(uint64_t val);
+
+  [[nodiscard]] uint64_t Get(size_t index) const;
+
+  [[nodiscard]] size_t GetBlockCnt() const;
+  // Decodes the block into `out`, which must hold `kBlockSize` values. Returns
+  // the number of values in the block.
+  size_t DecodeBlock(size_t block_index, uint64_t* out) const;
+
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+
+  // Number of bytes used by encoded blocks and the pending block.
+  [[nodiscard]] size_t GetMemorySize() const;
+
+ private:
+  struct Block {
+    uint64_t base;
+    size_t word_offset;
+    uint32_t bits;
+  };
+
+  void SealPending();
+
+  Array<Block> blocks_;
+  Array<uint64_t> words_;
+  Array<uint64_t> pending_;
+  size_t size_{0};
+};
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+PackedIntArray<BITS>::PackedIntArray(PackedIntArray&& other) noexcept
+    : words_(std::move(other.words_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+PackedIntArray<BITS>& PackedIntArray<BITS>::operator=(
+    PackedIntArray&& other) noexcept {
+  if (this != &other) {
+    words_ = std::move(other.words_);
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+void PackedIntArray<BITS>::Clear() {
+  words_.Clear();
+  size_ = 0;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+void PackedIntArray<BITS>::Push(const uint64_t val) {
+  const size_t word_cnt = GetWordCnt(size_ + 1);
+  while (words_.GetSize() < word_cnt) {
+    words_.Push(0);
+  }
+  ++size_;
+  Set(size_ - 1, val);
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+uint64_t PackedIntArray<BITS>::Get(const size_t index) const {
+  MIRAGE_DCHECK(index < size_);
+  return packed_int_internal::Read(words_.GetRawPtr(), index * BITS, BITS);
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+void PackedIntArray<BITS>::Set(const size_t index, const uint64_t val) {
+  MIRAGE_DCHECK(index < size_);
+  packed_int_internal::Write(words_.GetRawPtr(), index * BITS, BITS, val);
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+void PackedIntArray<BITS>::Reserve(const size_t capacity) {
+  words_.Reserve(GetWordCnt(capacity));
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+size_t PackedIntArray<BITS>::GetSize() const {
+  return size_;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+void PackedIntArray<BITS>::SetSize(const size_t size) {
+  if (size < size_) {
+    // Zero the dropped values, so growing again reads zeros.
+    for (size_t i = size; i < size_; ++i) {
+      Set(i, 0);
+    }
+  }
+  words_.SetSize(GetWordCnt(size));
+  size_ = size;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+bool PackedIntArray<BITS>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+size_t PackedIntArray<BITS>::GetWordCnt() const {
+  return words_.GetSize();
+}
+
+template <uint32_t BITS>
+  requires(BITS > 0 && BITS <= 64)
+size_t PackedIntArray<BITS>::GetWordCnt(const size_t size) {
+  return (size * BITS + 63) / 64;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_PACKED_INT_ARRAY
@@ -4,6 +4,7 @@
 #include <concepts>
 
 #include "mirage_base/container/array.hpp"
+#include "mirage_base/memory/allocator.hpp"
 #include "mirage_base/util/aligned_memory.hpp"
 #include "mirage_base/util/optional.hpp"
 
@@ -52,6 +53,9 @@ class RBTree {
 
   constexpr InsertResult None();
 
+  static Node* NewNode(T&& val);
+  static void DeleteNode(Node* node);
+
   Node* root_;
   size_t size_;
 };
@@ -168,7 +172,7 @@ typename RBTree<T, D>::RBTree::InsertResult RBTree<T, D>::RBTree::Insert(
 
   // Insert root node
   ++size_;
-  iter = new Node(std::move(val));
+  iter = NewNode(std::move(val));
   if (parent == nullptr) {
     iter->color = Node::BLACK;
     root_ = iter;
@@ -255,7 +259,7 @@ Optional<T> RBTree<T, D>::RBTree::Remove(const ConstIterator& target) {
     } else {
       parent->right = Node::Null();
     }
-    delete val_ptr;
+    DeleteNode(val_ptr);
     return rv;
   }
 
@@ -268,7 +272,7 @@ Optional<T> RBTree<T, D>::RBTree::Remove(const ConstIterator& target) {
     }
     val_ptr->left->parent = parent;
     val_ptr->left->color = Node::BLACK;
-    delete val_ptr;
+    DeleteNode(val_ptr);
     return rv;
   }
   if (right_exists) {  // && !left_exists
@@ -280,14 +284,14 @@ Optional<T> RBTree<T, D>::RBTree::Remove(const ConstIterator& target) {
     }
     val_ptr->right->parent = parent;
     val_ptr->right->color = Node::BLACK;
-    delete val_ptr;
+    DeleteNode(val_ptr);
     return rv;
   }
 
   // !left_exists && !right_exists && iter->color == Node::BLACK
   if (val_ptr == root_) {
     root_ = Node::Null();
-    delete val_ptr;
+    DeleteNode(val_ptr);
     return rv;
   }
 
@@ -352,7 +356,7 @@ Optional<T> RBTree<T, D>::RBTree::Remove(const ConstIterator& target) {
       iter = parent;
     }
   }
-  delete val_ptr;
+  DeleteNode(val_ptr);
   return rv;
 }
 
@@ -412,6 +416,8 @@ void RBTree<T, D>::RBTree::Clear() {
   if (root_ == Node::Null())
     return;
 
+  // Not on the scratch allocator, static sets are cleared during exit after
+  // the thread locals it lives in are destructed.
   Array<Node*> stack;
   stack.Push(root_);
   while (!stack.IsEmpty()) {
@@ -420,7 +426,7 @@ void RBTree<T, D>::RBTree::Clear() {
       stack.Push(node->left);
     if (node->right != Node::Null())
       stack.Push(node->right);
-    delete node;
+    DeleteNode(node);
   }
   root_ = Node::Null();
   size_ = 0;
@@ -504,6 +510,20 @@ constexpr typename RBTree<T, D>::InsertResult RBTree<T, D>::None() {
   }
 }
 
+template <RBTreeNodeType T, bool D>
+typename RBTree<T, D>::Node* RBTree<T, D>::NewNode(T&& val) {
+  void* ptr = HeapAllocator::Get(MemoryTag::kRBTree)
+                  .Allocate(sizeof(Node), alignof(Node));
+  return new (ptr) Node(std::move(val));
+}
+
+template <RBTreeNodeType T, bool D>
+void RBTree<T, D>::DeleteNode(Node* node) {
+  node->~Node();
+  HeapAllocator::Get(MemoryTag::kRBTree)
+      .Deallocate(node, sizeof(Node), alignof(Node));
+}
+
 template <RBTreeNodeType T, bool D>
 RBTree<T, D>::ConstIterator::ConstIterator(const ConstIterator& other)
     : here_(other.here_) {}
@@ -2,13 +2,19 @@
 #define MIRAGE_BASE_CONTAINER_SINGLY_LINKED_LIST
 
 #include <concepts>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <new>
 
 #include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
 
 namespace mirage::base {
 
+// Singly linked list that keeps both ends. Removed nodes are kept in a per
+// list cache and reused by later inserts, so a list used as a work queue
+// stops allocating once it has reached its peak size.
 template <std::move_constructible T>
 class SinglyLinkedList {
  public:
@@ -18,6 +24,9 @@ class SinglyLinkedList {
   class ConstIterator;
 
   SinglyLinkedList() = default;
+  // Takes nodes from `allocator`, which must outlive the list. Copies use the
+  // heap, moves keep the allocator of the source.
+  explicit SinglyLinkedList(Allocator& allocator);
 
   SinglyLinkedList(SinglyLinkedList&& other) noexcept;
   SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept;
@@ -32,14 +41,46 @@ class SinglyLinkedList {
 
   ~SinglyLinkedList();
 
+  // Allocates a node on the heap outside of any list, e.g. for lock-free
+  // containers.
+  template <typename... Args>
+  static Node* NewNode(Args&&... args);
+  static void DeleteNode(Node* node);
+
+  // Takes ownership of a null terminated chain of nodes from `NewNode`.
+  static SinglyLinkedList FromNodes(Node* head);
+  static SinglyLinkedList FromNodes(Node* head, Node* tail);
+
   template <typename... Args>
   void EmplaceHead(Args&&... args);
   void PushHead(const T& val)
     requires std::copy_constructible<T>;
 
+  template <typename... Args>
+  void EmplaceTail(Args&&... args);
+  void PushTail(const T& val)
+    requires std::copy_constructible<T>;
+
   T RemoveHead();
+  // Destructs all values and keeps the nodes in the cache.
   void Clear();
 
+  // Moves all elements of `other` to the front in O(1), keeping their order.
+  // Both lists must use the same allocator.
+  void SpliceFront(SinglyLinkedList&& other);
+  void Reverse();
+  // Stable bottom-up merge sort, relinks nodes and never moves values.
+  template <typename Compare = std::less<>>
+  void Sort(Compare compare = Compare());
+
+  // Fills the node cache so the next `cnt` inserts do not allocate.
+  void ReserveNodes(size_t cnt);
+  // Frees all cached nodes.
+  void ReleaseNodes();
+
+  [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] Allocator& GetAllocator() const;
+
   Iterator begin();
   Iterator end();
 
@@ -47,7 +88,21 @@ class SinglyLinkedList {
   ConstIterator end() const;
 
  private:
+  template <typename... Args>
+  Node* NewCachedNode(Args&&... args);
+  void DeleteCachedNode(Node* node);
+
+  static void* AllocateNode(Allocator& allocator);
+  static void DeallocateNode(Allocator& allocator, void* ptr);
+
+  template <typename Compare>
+  static Node* Merge(Node* front, Node* back, Compare& compare);
+
+  Allocator* allocator_{&HeapAllocator::Get(MemoryTag::kList)};
   Node* head_{nullptr};
+  Node* tail_{nullptr};
+  // Chain of raw node memory, each block stores the pointer to the next one.
+  void* node_cache_{nullptr};
 };
 
 template <std::move_constructible T>
@@ -79,7 +134,7 @@ class SinglyLinkedList<T>::Iterator {
 
   Iterator(const Iterator& other);
 
-  explicit Iterator(Node* here);
+  Iterator(SinglyLinkedList* list, Node* here);
 
   iterator_type& operator=(const iterator_type& other);
   iterator_type& operator=(std::nullptr_t);
@@ -100,6 +155,7 @@ class SinglyLinkedList<T>::Iterator {
  private:
   friend class ConstIterator;
 
+  SinglyLinkedList* list_{nullptr};
   Node* here_{nullptr};
 };
 
@@ -138,17 +194,26 @@ class SinglyLinkedList<T>::ConstIterator {
   Node* here_{nullptr};
 };
 
+template <std::move_constructible T>
+SinglyLinkedList<T>::SinglyLinkedList(Allocator& allocator)
+    : allocator_(&allocator) {}
+
 template <std::move_constructible T>
 SinglyLinkedList<T>::SinglyLinkedList(SinglyLinkedList&& other) noexcept
-    : head_(other.head_) {
+    : allocator_(other.allocator_),
+      head_(other.head_),
+      tail_(other.tail_),
+      node_cache_(other.node_cache_) {
   other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.node_cache_ = nullptr;
 }
 
 template <std::move_constructible T>
 SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(
     SinglyLinkedList&& other) noexcept {
   if (this != &other) {
-    Clear();
+    this->~SinglyLinkedList();
     new (this) SinglyLinkedList(std::move(other));
   }
   return *this;
@@ -158,18 +223,8 @@ template <std::move_constructible T>
 SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList& other)
   requires std::copy_constructible<T>
 {
-  auto iter = other.begin();
-  if (iter == other.end()) {
-    return;
-  }
-  Node* ptr = new Node(T(*iter));
-  head_ = ptr;
-  ++iter;
-  while (iter != other.end()) {
-    Node* next = new Node(T(*iter));
-    ptr->next = next;
-    ptr = next;
-    ++iter;
+  for (const T& val : other) {
+    EmplaceTail(T(val));
   }
 }
 
@@ -179,7 +234,7 @@ SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(
   requires std::copy_constructible<T>
 {
   if (this != &other) {
-    Clear();
+    this->~SinglyLinkedList();
     new (this) SinglyLinkedList(other);
   }
   return *this;
@@ -189,32 +244,58 @@ template <std::move_constructible T>
 SinglyLinkedList<T>::SinglyLinkedList(std::initializer_list<T> list)
   requires std::copy_constructible<T>
 {
-  if (list.size() == 0) {
-    return;
-  }
-  auto iter = list.begin();
-  Node* ptr = new Node(T(*iter));
-  head_ = ptr;
-  ++iter;
-  while (iter != list.end()) {
-    Node* next = new Node(T(*iter));
-    ptr->next = next;
-    ptr = next;
-    ++iter;
+  for (const T& val : list) {
+    EmplaceTail(T(val));
   }
 }
 
 template <std::move_constructible T>
 SinglyLinkedList<T>::~SinglyLinkedList() {
   Clear();
+  ReleaseNodes();
+}
+
+template <std::move_constructible T>
+template <typename... Args>
+typename SinglyLinkedList<T>::Node* SinglyLinkedList<T>::NewNode(
+    Args&&... args) {
+  return new (AllocateNode(HeapAllocator::Get(MemoryTag::kList)))
+      Node(T(std::forward<Args>(args)...));
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::DeleteNode(Node* node) {
+  node->~Node();
+  DeallocateNode(HeapAllocator::Get(MemoryTag::kList), node);
+}
+
+template <std::move_constructible T>
+SinglyLinkedList<T> SinglyLinkedList<T>::FromNodes(Node* head) {
+  Node* tail = head;
+  while (tail != nullptr && tail->next != nullptr) {
+    tail = tail->next;
+  }
+  return FromNodes(head, tail);
+}
+
+template <std::move_constructible T>
+SinglyLinkedList<T> SinglyLinkedList<T>::FromNodes(Node* head, Node* tail) {
+  MIRAGE_DCHECK(tail == nullptr || tail->next == nullptr);
+  SinglyLinkedList list;
+  list.head_ = head;
+  list.tail_ = tail;
+  return list;
 }
 
 template <std::move_constructible T>
 template <typename... Args>
 void SinglyLinkedList<T>::EmplaceHead(Args&&... args) {
-  Node* new_head = new Node(T(std::forward<Args>(args)...));
+  Node* new_head = NewCachedNode(std::forward<Args>(args)...);
   new_head->next = head_;
   head_ = new_head;
+  if (tail_ == nullptr) {
+    tail_ = new_head;
+  }
 }
 
 template <std::move_constructible T>
@@ -224,13 +305,35 @@ void SinglyLinkedList<T>::PushHead(const T& val)
   EmplaceHead(T(val));
 }
 
+template <std::move_constructible T>
+template <typename... Args>
+void SinglyLinkedList<T>::EmplaceTail(Args&&... args) {
+  Node* new_tail = NewCachedNode(std::forward<Args>(args)...);
+  if (tail_ == nullptr) {
+    head_ = new_tail;
+  } else {
+    tail_->next = new_tail;
+  }
+  tail_ = new_tail;
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::PushTail(const T& val)
+  requires std::copy_constructible<T>
+{
+  EmplaceTail(T(val));
+}
+
 template <std::move_constructible T>
 T SinglyLinkedList<T>::RemoveHead() {
   MIRAGE_DCHECK(head_ != nullptr);
   T val(std::move(head_->val));
-  const Node* head = head_;
+  Node* head = head_;
   head_ = head_->next;
-  delete head;
+  if (head_ == nullptr) {
+    tail_ = nullptr;
+  }
+  DeleteCachedNode(head);
   return std::move(val);
 }
 
@@ -239,20 +342,112 @@ void SinglyLinkedList<T>::Clear() {
   Node* ptr = head_;
   while (ptr != nullptr) {
     Node* next = ptr->next;
-    delete ptr;
+    DeleteCachedNode(ptr);
     ptr = next;
   }
   head_ = nullptr;
+  tail_ = nullptr;
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::SpliceFront(SinglyLinkedList&& other) {
+  if (this == &other || other.head_ == nullptr) {
+    return;
+  }
+  MIRAGE_DCHECK(allocator_ == other.allocator_);
+  other.tail_->next = head_;
+  if (tail_ == nullptr) {
+    tail_ = other.tail_;
+  }
+  head_ = other.head_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::Reverse() {
+  Node* reversed = nullptr;
+  Node* ptr = head_;
+  tail_ = head_;
+  while (ptr != nullptr) {
+    Node* next = ptr->next;
+    ptr->next = reversed;
+    reversed = ptr;
+    ptr = next;
+  }
+  head_ = reversed;
+}
+
+template <std::move_constructible T>
+template <typename Compare>
+void SinglyLinkedList<T>::Sort(Compare compare) {
+  // `bins[i]` is empty or a sorted run of 2^i nodes. Runs in higher bins hold
+  // earlier nodes, which keeps equal values in their original order.
+  constexpr size_t kBinCnt = 64;
+  Node* bins[kBinCnt] = {};
+  Node* ptr = head_;
+  while (ptr != nullptr) {
+    Node* carry = ptr;
+    ptr = ptr->next;
+    carry->next = nullptr;
+    size_t i = 0;
+    while (i < kBinCnt - 1 && bins[i] != nullptr) {
+      carry = Merge(bins[i], carry, compare);
+      bins[i] = nullptr;
+      ++i;
+    }
+    bins[i] = carry;
+  }
+
+  Node* sorted = nullptr;
+  for (Node* bin : bins) {
+    if (bin != nullptr) {
+      sorted = Merge(bin, sorted, compare);
+    }
+  }
+  head_ = sorted;
+  tail_ = sorted;
+  while (tail_ != nullptr && tail_->next != nullptr) {
+    tail_ = tail_->next;
+  }
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::ReserveNodes(const size_t cnt) {
+  for (size_t i = 0; i < cnt; ++i) {
+    void* ptr = AllocateNode(*allocator_);
+    new (ptr) void*(node_cache_);
+    node_cache_ = ptr;
+  }
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::ReleaseNodes() {
+  while (node_cache_ != nullptr) {
+    void* next = *static_cast<void**>(node_cache_);
+    DeallocateNode(*allocator_, node_cache_);
+    node_cache_ = next;
+  }
+}
+
+template <std::move_constructible T>
+bool SinglyLinkedList<T>::IsEmpty() const {
+  return head_ == nullptr;
+}
+
+template <std::move_constructible T>
+Allocator& SinglyLinkedList<T>::GetAllocator() const {
+  return *allocator_;
 }
 
 template <std::move_constructible T>
 typename SinglyLinkedList<T>::Iterator SinglyLinkedList<T>::begin() {
-  return Iterator(head_);
+  return Iterator(this, head_);
 }
 
 template <std::move_constructible T>
 typename SinglyLinkedList<T>::Iterator SinglyLinkedList<T>::end() {
-  return Iterator();
+  return Iterator(this, nullptr);
 }
 
 template <std::move_constructible T>
@@ -265,17 +460,70 @@ typename SinglyLinkedList<T>::ConstIterator SinglyLinkedList<T>::end() const {
   return ConstIterator();
 }
 
+template <std::move_constructible T>
+template <typename... Args>
+typename SinglyLinkedList<T>::Node* SinglyLinkedList<T>::NewCachedNode(
+    Args&&... args) {
+  void* ptr = node_cache_;
+  if (ptr == nullptr) {
+    ptr = AllocateNode(*allocator_);
+  } else {
+    node_cache_ = *static_cast<void**>(ptr);
+  }
+  return new (ptr) Node(T(std::forward<Args>(args)...));
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::DeleteCachedNode(Node* node) {
+  node->~Node();
+  new (node) void*(node_cache_);
+  node_cache_ = node;
+}
+
+template <std::move_constructible T>
+void* SinglyLinkedList<T>::AllocateNode(Allocator& allocator) {
+  return allocator.Allocate(sizeof(Node), alignof(Node));
+}
+
+template <std::move_constructible T>
+void SinglyLinkedList<T>::DeallocateNode(Allocator& allocator, void* ptr) {
+  allocator.Deallocate(ptr, sizeof(Node), alignof(Node));
+}
+
+template <std::move_constructible T>
+template <typename Compare>
+typename SinglyLinkedList<T>::Node* SinglyLinkedList<T>::Merge(
+    Node* front, Node* back, Compare& compare) {
+  Node* head = nullptr;
+  Node** link = &head;
+  while (front != nullptr && back != nullptr) {
+    // Take from `front` on ties to stay stable.
+    if (compare(back->val, front->val)) {
+      *link = back;
+      back = back->next;
+    } else {
+      *link = front;
+      front = front->next;
+    }
+    link = &(*link)->next;
+  }
+  *link = front != nullptr ? front : back;
+  return head;
+}
+
 template <std::move_constructible T>
 SinglyLinkedList<T>::Iterator::Iterator(const Iterator& other)
-    : here_(other.here_) {}
+    : list_(other.list_), here_(other.here_) {}
 
 template <std::move_constructible T>
-SinglyLinkedList<T>::Iterator::Iterator(Node* here) : here_(here) {}
+SinglyLinkedList<T>::Iterator::Iterator(SinglyLinkedList* list, Node* here)
+    : list_(list), here_(here) {}
 
 template <std::move_constructible T>
 typename SinglyLinkedList<T>::Iterator::iterator_type&
 SinglyLinkedList<T>::Iterator::operator=(const iterator_type& other) {
   if (this != &other) {
+    list_ = other.list_;
     here_ = other.here_;
   }
   return *this;
@@ -339,9 +587,13 @@ SinglyLinkedList<T>::Iterator::operator bool() const {
 template <std::move_constructible T>
 template <typename... Args>
 void SinglyLinkedList<T>::Iterator::EmplaceAfter(Args&&... args) {
-  Node* new_node = new Node(T(std::forward<Args>(args)...));
+  MIRAGE_DCHECK(here_ != nullptr);
+  Node* new_node = list_->NewCachedNode(std::forward<Args>(args)...);
   new_node->next = here_->next;
   here_->next = new_node;
+  if (list_->tail_ == here_) {
+    list_->tail_ = new_node;
+  }
 }
 
 template <std::move_constructible T>
@@ -354,10 +606,13 @@ void SinglyLinkedList<T>::Iterator::InsertAfter(const T& val)
 template <std::move_constructible T>
 T SinglyLinkedList<T>::Iterator::RemoveAfter() {
   MIRAGE_DCHECK(here_ != nullptr && here_->next != nullptr);
-  T val(std::move(here_->next->val));
-  const Node* next = here_->next;
-  here_->next = nullptr;
-  delete next;
+  Node* next = here_->next;
+  T val(std::move(next->val));
+  here_->next = next->next;
+  if (list_->tail_ == next) {
+    list_->tail_ = here_;
+  }
+  list_->DeleteCachedNode(next);
   return std::move(val);
 }
 
@@ -0,0 +1,390 @@
+#ifndef MIRAGE_BASE_CONTAINER_SOA_ARRAY
+#define MIRAGE_BASE_CONTAINER_SOA_ARRAY
+
+#include <concepts>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+
+namespace mirage::base {
+
+// Structure-of-Arrays container. Each field is kept in its own contiguous,
+// cache line aligned buffer, while size and capacity are shared by all fields.
+// Loops that only touch a few fields can walk the spans returned by `GetSpan`
+// without pulling the other fields into cache.
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+class SoAArray {
+ public:
+  class Row;
+
+  template <size_t I>
+  using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+  static constexpr size_t kFieldCnt = sizeof...(Fields);
+
+  SoAArray() = default;
+
+  SoAArray(const SoAArray& other)
+    requires(std::copy_constructible<Fields> && ...);
+  SoAArray& operator=(const SoAArray& other)
+    requires(std::copy_constructible<Fields> && ...);
+
+  SoAArray(SoAArray&& other) noexcept;
+  SoAArray& operator=(SoAArray&& other) noexcept;
+
+  ~SoAArray() noexcept;
+  void Clear();
+
+  void Push(const Fields&... vals)
+    requires(std::copy_constructible<Fields> && ...);
+
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Fields))
+  void Emplace(Args&&... args);
+
+  Row operator[](size_t index) const;
+
+  template <size_t I>
+  FieldType<I>& Get(size_t index) const;
+
+  template <size_t I>
+  FieldType<I>* GetRawPtr() const;
+
+  template <size_t I>
+  Span<FieldType<I>> GetSpan();
+
+  template <size_t I>
+  ConstSpan<FieldType<I>> GetSpan() const;
+
+  void Reserve(size_t capacity);
+
+  [[nodiscard]] size_t GetSize() const;
+  void SetSize(size_t size);
+  [[nodiscard]] bool IsEmpty() const;
+
+  [[nodiscard]] size_t GetCapacity() const;
+  void SetCapacity(size_t capacity);
+
+ private:
+  template <typename F>
+  static constexpr size_t kAlign = alignof(F) > 64 ? alignof(F) : 64;
+
+  template <typename F>
+  static F* AllocateField(size_t capacity);
+
+  template <typename F>
+  static void DeallocateField(F* ptr, size_t capacity);
+
+  template <size_t... Is, typename... Args>
+  void EmplaceAt(std::index_sequence<Is...>, size_t index, Args&&... args);
+
+  template <size_t... Is>
+  void DestroyAt(std::index_sequence<Is...>, size_t index);
+
+  template <size_t... Is>
+  void Reallocate(std::index_sequence<Is...>, size_t capacity);
+
+  void EnsureNotFull();
+
+  std::tuple<Fields*...> data_{};
+  size_t size_{0};
+  size_t capacity_{0};
+};
+
+// Proxy to one row of the array, only holds the array and the row index.
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+class SoAArray<Fields...>::Row {
+ public:
+  Row() = delete;
+  ~Row() = default;
+
+  Row(const SoAArray& array, size_t index);
+
+  template <size_t I>
+  FieldType<I>& Get() const;
+
+  [[nodiscard]] size_t GetIndex() const;
+
+ private:
+  const SoAArray& array_;
+  size_t index_;
+};
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>::SoAArray(const SoAArray& other)
+  requires(std::copy_constructible<Fields> && ...)
+{
+  Reserve(other.size_);
+  for (size_t i = 0; i < other.size_; ++i) {
+    [&]<size_t... Is>(std::index_sequence<Is...>) {
+      Push(other.Get<Is>(i)...);
+    }(std::index_sequence_for<Fields...>());
+  }
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>& SoAArray<Fields...>::operator=(const SoAArray& other)
+  requires(std::copy_constructible<Fields> && ...)
+{
+  if (this != &other) {
+    Clear();
+    new (this) SoAArray(other);
+  }
+  return *this;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>::SoAArray(SoAArray&& other) noexcept
+    : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+  other.data_ = {};
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>& SoAArray<Fields...>::operator=(SoAArray&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    new (this) SoAArray(std::move(other));
+  }
+  return *this;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>::~SoAArray() noexcept {
+  Clear();
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::Clear() {
+  for (size_t i = 0; i < size_; ++i) {
+    DestroyAt(std::index_sequence_for<Fields...>(), i);
+  }
+  std::apply(
+      [this](Fields*... ptrs) { (DeallocateField(ptrs, capacity_), ...); },
+      data_);
+  data_ = {};
+  size_ = 0;
+  capacity_ = 0;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::Push(const Fields&... vals)
+  requires(std::copy_constructible<Fields> && ...)
+{
+  Emplace(Fields(vals)...);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <typename... Args>
+  requires(sizeof...(Args) == sizeof...(Fields))
+void SoAArray<Fields...>::Emplace(Args&&... args) {
+  EnsureNotFull();
+  EmplaceAt(std::index_sequence_for<Fields...>(), size_,
+            std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+typename SoAArray<Fields...>::Row SoAArray<Fields...>::operator[](
+    const size_t index) const {
+  MIRAGE_DCHECK(index < size_);
+  return Row(*this, index);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t I>
+typename SoAArray<Fields...>::template FieldType<I>& SoAArray<Fields...>::Get(
+    const size_t index) const {
+  return std::get<I>(data_)[index];
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t I>
+typename SoAArray<Fields...>::template FieldType<I>*
+SoAArray<Fields...>::GetRawPtr() const {
+  return std::get<I>(data_);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t I>
+Span<typename SoAArray<Fields...>::template FieldType<I>>
+SoAArray<Fields...>::GetSpan() {
+  return {std::get<I>(data_), size_};
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t I>
+ConstSpan<typename SoAArray<Fields...>::template FieldType<I>>
+SoAArray<Fields...>::GetSpan() const {
+  return {std::get<I>(data_), size_};
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::Reserve(const size_t capacity) {
+  if (capacity <= capacity_) {
+    return;
+  }
+  SetCapacity(capacity);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+size_t SoAArray<Fields...>::GetSize() const {
+  return size_;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::SetSize(const size_t size) {
+  if (size == size_) {
+    return;
+  }
+  if (size < size_) {
+    while (size < size_) {
+      --size_;
+      DestroyAt(std::index_sequence_for<Fields...>(), size_);
+    }
+    return;
+  }
+
+  if constexpr (!(std::default_initializable<Fields> && ...)) {
+    MIRAGE_DCHECK(false);
+  } else {
+    Reserve(size);
+    while (size > size_) {
+      Emplace(Fields()...);
+    }
+  }
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+bool SoAArray<Fields...>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+size_t SoAArray<Fields...>::GetCapacity() const {
+  return capacity_;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::SetCapacity(const size_t capacity) {
+  if (capacity == capacity_) {
+    return;
+  }
+  SetSize(capacity < size_ ? capacity : size_);
+  Reallocate(std::index_sequence_for<Fields...>(), capacity);
+  capacity_ = capacity;
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <typename F>
+F* SoAArray<Fields...>::AllocateField(const size_t capacity) {
+  if (capacity == 0) {
+    return nullptr;
+  }
+  return static_cast<F*>(HeapAllocator::Get(MemoryTag::kArray)
+                             .Allocate(capacity * sizeof(F), kAlign<F>));
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <typename F>
+void SoAArray<Fields...>::DeallocateField(F* ptr, const size_t capacity) {
+  if (ptr != nullptr) {
+    HeapAllocator::Get(MemoryTag::kArray)
+        .Deallocate(ptr, capacity * sizeof(F), kAlign<F>);
+  }
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t... Is, typename... Args>
+void SoAArray<Fields...>::EmplaceAt(std::index_sequence<Is...>,
+                                    const size_t index, Args&&... args) {
+  (new (std::get<Is>(data_) + index) FieldType<Is>(std::forward<Args>(args)),
+   ...);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t... Is>
+void SoAArray<Fields...>::DestroyAt(std::index_sequence<Is...>,
+                                    const size_t index) {
+  (std::get<Is>(data_)[index].~FieldType<Is>(), ...);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t... Is>
+void SoAArray<Fields...>::Reallocate(std::index_sequence<Is...>,
+                                     const size_t capacity) {
+  auto move_field = [this, capacity]<typename F>(F*& field) {
+    F* data = AllocateField<F>(capacity);
+    for (size_t i = 0; i < size_; ++i) {
+      new (data + i) F(std::move(field[i]));
+      field[i].~F();
+    }
+    DeallocateField(field, capacity_);
+    field = data;
+  };
+  (move_field(std::get<Is>(data_)), ...);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+void SoAArray<Fields...>::EnsureNotFull() {
+  if (capacity_ == 0) {
+    SetCapacity(1);
+  } else if (size_ == capacity_) {
+    SetCapacity(2 * capacity_);
+  }
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+SoAArray<Fields...>::Row::Row(const SoAArray& array, const size_t index)
+    : array_(array), index_(index) {}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+template <size_t I>
+typename SoAArray<Fields...>::template FieldType<I>&
+SoAArray<Fields...>::Row::Get() const {
+  return array_.template Get<I>(index_);
+}
+
+template <std::move_constructible... Fields>
+  requires(sizeof...(Fields) > 0)
+size_t SoAArray<Fields...>::Row::GetIndex() const {
+  return index_;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_SOA_ARRAY
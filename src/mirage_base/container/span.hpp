@@ -0,0 +1,233 @@
+#ifndef MIRAGE_BASE_CONTAINER_SPAN
+#define MIRAGE_BASE_CONTAINER_SPAN
+
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+constexpr size_t kDynamicExtent = std::numeric_limits<size_t>::max();
+
+// Non-owning view of a contiguous range. With a static `EXTENT` the size is a
+// compile time constant and only the pointer is stored.
+template <typename T, size_t EXTENT = kDynamicExtent>
+class Span {
+ public:
+  using Iterator = T*;
+
+  static constexpr bool kIsDynamic = EXTENT == kDynamicExtent;
+
+  Span()
+    requires(kIsDynamic || EXTENT == 0)
+  = default;
+  ~Span() = default;
+
+  Span(const Span& other) = default;
+  Span& operator=(const Span& other) = default;
+
+  Span(T* ptr, size_t size);
+
+  template <size_t N>
+    requires(EXTENT == kDynamicExtent || EXTENT == N)
+  // NOLINTNEXTLINE: Convert from raw array
+  Span(T (&array)[N]);
+
+  template <size_t ALIGN>
+  // NOLINTNEXTLINE: Convert from Array
+  Span(const Array<std::remove_const_t<T>, ALIGN>& array)
+    requires kIsDynamic;
+  template <size_t ALIGN>
+  explicit Span(const Array<std::remove_const_t<T>, ALIGN>& array)
+    requires(!kIsDynamic);
+
+  // Converts to a span of const, or from a static to a dynamic extent.
+  template <typename U, size_t N>
+    requires std::convertible_to<U (*)[], T (*)[]> &&
+             (EXTENT == kDynamicExtent || EXTENT == N)
+  // NOLINTNEXTLINE: Convert to const
+  Span(const Span<U, N>& other);
+
+  T& operator[](size_t index) const;
+
+  T* GetRawPtr() const;
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] size_t GetSizeBytes() const;
+  [[nodiscard]] bool IsEmpty() const;
+
+  Span<T> First(size_t cnt) const;
+  Span<T> Last(size_t cnt) const;
+  Span<T> Subspan(size_t offset, size_t cnt = kDynamicExtent) const;
+
+  template <size_t CNT>
+  Span<T, CNT> First() const;
+  template <size_t CNT>
+  Span<T, CNT> Last() const;
+
+  // Splits into chunks of `chunk_size` elements for parallel work. Every
+  // chunk except the last one is full.
+  [[nodiscard]] size_t GetChunkCnt(size_t chunk_size) const;
+  Span<T> GetChunk(size_t chunk_size, size_t chunk_index) const;
+
+  Span<const std::byte> AsBytes() const;
+  Span<std::byte> AsWritableBytes() const
+    requires(!std::is_const_v<T>);
+
+  Iterator begin() const;
+  Iterator end() const;
+
+ private:
+  struct StaticSize {};
+  using Size = std::conditional_t<kIsDynamic, size_t, StaticSize>;
+
+  T* ptr_{nullptr};
+  [[no_unique_address]] Size size_{};
+};
+
+template <typename T>
+using ConstSpan = Span<const T>;
+
+template <typename T, size_t E>
+Span<T, E>::Span(T* ptr, const size_t size) : ptr_(ptr) {
+  if constexpr (kIsDynamic) {
+    size_ = size;
+  } else {
+    MIRAGE_DCHECK(size == E);
+  }
+}
+
+template <typename T, size_t E>
+template <size_t N>
+  requires(E == kDynamicExtent || E == N)
+Span<T, E>::Span(T (&array)[N]) : Span(array, N) {}
+
+template <typename T, size_t E>
+template <size_t A>
+Span<T, E>::Span(const Array<std::remove_const_t<T>, A>& array)
+  requires(kIsDynamic)
+    : Span(array.GetRawPtr(), array.GetSize()) {}
+
+template <typename T, size_t E>
+template <size_t A>
+Span<T, E>::Span(const Array<std::remove_const_t<T>, A>& array)
+  requires(!kIsDynamic)
+    : Span(array.GetRawPtr(), array.GetSize()) {}
+
+template <typename T, size_t E>
+template <typename U, size_t N>
+  requires std::convertible_to<U (*)[], T (*)[]> &&
+           (E == kDynamicExtent || E == N)
+Span<T, E>::Span(const Span<U, N>& other)
+    : Span(other.GetRawPtr(), other.GetSize()) {}
+
+template <typename T, size_t E>
+T& Span<T, E>::operator[](const size_t index) const {
+  MIRAGE_DCHECK(index < GetSize());
+  return ptr_[index];
+}
+
+template <typename T, size_t E>
+T* Span<T, E>::GetRawPtr() const {
+  return ptr_;
+}
+
+template <typename T, size_t E>
+size_t Span<T, E>::GetSize() const {
+  if constexpr (kIsDynamic) {
+    return size_;
+  } else {
+    return E;
+  }
+}
+
+template <typename T, size_t E>
+size_t Span<T, E>::GetSizeBytes() const {
+  return GetSize() * sizeof(T);
+}
+
+template <typename T, size_t E>
+bool Span<T, E>::IsEmpty() const {
+  return GetSize() == 0;
+}
+
+template <typename T, size_t E>
+Span<T> Span<T, E>::First(const size_t cnt) const {
+  MIRAGE_DCHECK(cnt <= GetSize());
+  return {ptr_, cnt};
+}
+
+template <typename T, size_t E>
+Span<T> Span<T, E>::Last(const size_t cnt) const {
+  MIRAGE_DCHECK(cnt <= GetSize());
+  return {ptr_ + (GetSize() - cnt), cnt};
+}
+
+template <typename T, size_t E>
+Span<T> Span<T, E>::Subspan(const size_t offset, const size_t cnt) const {
+  MIRAGE_DCHECK(offset <= GetSize());
+  const size_t rest = GetSize() - offset;
+  if (cnt == kDynamicExtent) {
+    return {ptr_ + offset, rest};
+  }
+  MIRAGE_DCHECK(cnt <= rest);
+  return {ptr_ + offset, cnt};
+}
+
+template <typename T, size_t E>
+template <size_t CNT>
+Span<T, CNT> Span<T, E>::First() const {
+  MIRAGE_DCHECK(CNT <= GetSize());
+  return {ptr_, CNT};
+}
+
+template <typename T, size_t E>
+template <size_t CNT>
+Span<T, CNT> Span<T, E>::Last() const {
+  MIRAGE_DCHECK(CNT <= GetSize());
+  return {ptr_ + (GetSize() - CNT), CNT};
+}
+
+template <typename T, size_t E>
+size_t Span<T, E>::GetChunkCnt(const size_t chunk_size) const {
+  MIRAGE_DCHECK(chunk_size != 0);
+  return (GetSize() + chunk_size - 1) / chunk_size;
+}
+
+template <typename T, size_t E>
+Span<T> Span<T, E>::GetChunk(const size_t chunk_size,
+                             const size_t chunk_index) const {
+  MIRAGE_DCHECK(chunk_index < GetChunkCnt(chunk_size));
+  const size_t offset = chunk_index * chunk_size;
+  const size_t rest = GetSize() - offset;
+  return {ptr_ + offset, rest < chunk_size ? rest : chunk_size};
+}
+
+template <typename T, size_t E>
+Span<const std::byte> Span<T, E>::AsBytes() const {
+  return {reinterpret_cast<const std::byte*>(ptr_), GetSizeBytes()};
+}
+
+template <typename T, size_t E>
+Span<std::byte> Span<T, E>::AsWritableBytes() const
+  requires(!std::is_const_v<T>)
+{
+  return {reinterpret_cast<std::byte*>(ptr_), GetSizeBytes()};
+}
+
+template <typename T, size_t E>
+typename Span<T, E>::Iterator Span<T, E>::begin() const {
+  return ptr_;
+}
+
+template <typename T, size_t E>
+typename Span<T, E>::Iterator Span<T, E>::end() const {
+  return ptr_ + GetSize();
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_SPAN
@@ -0,0 +1,217 @@
+#ifndef MIRAGE_BASE_CONTAINER_TREIBER_STACK
+#define MIRAGE_BASE_CONTAINER_TREIBER_STACK
+
+#include <atomic>
+#include <concepts>
+#include <memory>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/singly_linked_list.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/util/optional.hpp"
+
+namespace mirage::base {
+
+// Lock-free multi-producer multi-consumer LIFO stack over `SinglyLinkedList`
+// nodes. The head keeps a 16 bit modification tag in the unused upper bits of
+// the pointer, so a CAS fails if the head was popped and pushed back in
+// between (ABA). Popped nodes go to an internal free list and are reused by
+// later pushes, so a stale reader never touches freed memory.
+template <std::move_constructible T>
+class TreiberStack {
+ public:
+  using Node = typename SinglyLinkedList<T>::Node;
+
+  TreiberStack() = default;
+  ~TreiberStack();
+
+  TreiberStack(const TreiberStack&) = delete;
+  TreiberStack& operator=(const TreiberStack&) = delete;
+  TreiberStack(TreiberStack&&) = delete;
+  TreiberStack& operator=(TreiberStack&&) = delete;
+
+  template <typename... Args>
+  void Emplace(Args&&... args);
+  void Push(const T& val)
+    requires std::copy_constructible<T>;
+
+  Optional<T> TryPop();
+  // Takes every element, newest first, with a single exchange of the head.
+  // The nodes join the free list like those of `TryPop`, so both may run
+  // concurrently.
+  Array<T> PopAll();
+
+  // May be stale as soon as it returns.
+  [[nodiscard]] bool IsEmpty() const;
+
+ private:
+  // Pointer to the first node, with a modification tag in the upper 16 bits.
+  class TaggedHead {
+   public:
+    void Push(Node* node);
+    // Pushes the chain from `first` to `last` at once.
+    void Push(Node* first, Node* last);
+    Node* Pop();
+    Node* Exchange(Node* node);
+    [[nodiscard]] Node* Load() const;
+
+   private:
+    static constexpr uint32_t kTagShift = 48;
+    static constexpr uint64_t kPtrMask = (uint64_t{1} << kTagShift) - 1;
+
+    static uint64_t Pack(Node* node, uint64_t bits);
+    static Node* Unpack(uint64_t bits);
+
+    std::atomic<uint64_t> bits_{0};
+  };
+
+  static_assert(sizeof(Node*) == sizeof(uint64_t));
+
+  static void DeleteChain(Node* node);
+
+  TaggedHead head_;
+  // Nodes whose values have been moved out, kept alive until destruction.
+  TaggedHead free_;
+};
+
+template <std::move_constructible T>
+TreiberStack<T>::~TreiberStack() {
+  DeleteChain(head_.Exchange(nullptr));
+  DeleteChain(free_.Exchange(nullptr));
+}
+
+template <std::move_constructible T>
+template <typename... Args>
+void TreiberStack<T>::Emplace(Args&&... args) {
+  Node* node = free_.Pop();
+  if (node == nullptr) {
+    node = SinglyLinkedList<T>::NewNode(std::forward<Args>(args)...);
+  } else {
+    std::destroy_at(&node->val);
+    std::construct_at(&node->val, T(std::forward<Args>(args)...));
+  }
+  head_.Push(node);
+}
+
+template <std::move_constructible T>
+void TreiberStack<T>::Push(const T& val)
+  requires std::copy_constructible<T>
+{
+  Emplace(T(val));
+}
+
+template <std::move_constructible T>
+Optional<T> TreiberStack<T>::TryPop() {
+  Node* node = head_.Pop();
+  if (node == nullptr) {
+    return Optional<T>::None();
+  }
+  Optional<T> val(std::move(node->val));
+  free_.Push(node);
+  return val;
+}
+
+template <std::move_constructible T>
+Array<T> TreiberStack<T>::PopAll() {
+  Array<T> vals;
+  Node* first = head_.Exchange(nullptr);
+  if (first == nullptr) {
+    return vals;
+  }
+  Node* last = first;
+  while (true) {
+    vals.Emplace(std::move(last->val));
+    // A stale `Pop` may read `next` at the same time.
+    Node* next =
+        std::atomic_ref<Node*>(last->next).load(std::memory_order_relaxed);
+    if (next == nullptr) {
+      break;
+    }
+    last = next;
+  }
+  free_.Push(first, last);
+  return vals;
+}
+
+template <std::move_constructible T>
+bool TreiberStack<T>::IsEmpty() const {
+  return head_.Load() == nullptr;
+}
+
+template <std::move_constructible T>
+void TreiberStack<T>::DeleteChain(Node* node) {
+  while (node != nullptr) {
+    Node* next = node->next;
+    SinglyLinkedList<T>::DeleteNode(node);
+    node = next;
+  }
+}
+
+template <std::move_constructible T>
+void TreiberStack<T>::TaggedHead::Push(Node* node) {
+  Push(node, node);
+}
+
+template <std::move_constructible T>
+void TreiberStack<T>::TaggedHead::Push(Node* first, Node* last) {
+  uint64_t bits = bits_.load(std::memory_order_relaxed);
+  do {
+    // A stale `Pop` may read `next` of a recycled node at the same time.
+    std::atomic_ref<Node*>(last->next).store(Unpack(bits),
+                                             std::memory_order_relaxed);
+  } while (!bits_.compare_exchange_weak(bits, Pack(first, bits),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+template <std::move_constructible T>
+typename TreiberStack<T>::Node* TreiberStack<T>::TaggedHead::Pop() {
+  uint64_t bits = bits_.load(std::memory_order_acquire);
+  while (true) {
+    Node* node = Unpack(bits);
+    if (node == nullptr) {
+      return nullptr;
+    }
+    Node* next =
+        std::atomic_ref<Node*>(node->next).load(std::memory_order_relaxed);
+    if (bits_.compare_exchange_weak(bits, Pack(next, bits),
+                                    std::memory_order_acquire,
+                                    std::memory_order_acquire)) {
+      return node;
+    }
+  }
+}
+
+template <std::move_constructible T>
+typename TreiberStack<T>::Node* TreiberStack<T>::TaggedHead::Exchange(
+    Node* node) {
+  uint64_t bits = bits_.load(std::memory_order_relaxed);
+  while (!bits_.compare_exchange_weak(bits, Pack(node, bits),
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed)) {
+  }
+  return Unpack(bits);
+}
+
+template <std::move_constructible T>
+typename TreiberStack<T>::Node* TreiberStack<T>::TaggedHead::Load() const {
+  return Unpack(bits_.load(std::memory_order_acquire));
+}
+
+template <std::move_constructible T>
+uint64_t TreiberStack<T>::TaggedHead::Pack(Node* node, const uint64_t bits) {
+  const auto ptr = reinterpret_cast<uint64_t>(node);
+  MIRAGE_DCHECK((ptr & ~kPtrMask) == 0);
+  const uint64_t tag = (bits >> kTagShift) + 1;
+  return (tag << kTagShift) | ptr;
+}
+
+template <std::move_constructible T>
+typename TreiberStack<T>::Node* TreiberStack<T>::TaggedHead::Unpack(
+    const uint64_t bits) {
+  return reinterpret_cast<Node*>(bits & kPtrMask);
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_TREIBER_STACK
@@ -0,0 +1,630 @@
+#ifndef MIRAGE_BASE_CONTAINER_UNROLLED_LIST
+#define MIRAGE_BASE_CONTAINER_UNROLLED_LIST
+
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+#include "mirage_base/util/aligned_memory.hpp"
+
+namespace mirage::base {
+
+// Doubly linked list whose nodes each hold up to `N` elements inline. Scans
+// touch one node per `N` elements, while inserting or removing in the middle
+// only shifts elements within one node. A full node is split in half on
+// insertion, and a node that falls below half full after removal merges with
+// or borrows from its successor.
+template <std::move_constructible T, size_t N = 16>
+  requires(N >= 2)
+class UnrolledList {
+ public:
+  struct Node;
+
+  class Iterator;
+  class ConstIterator;
+
+  UnrolledList() = default;
+
+  UnrolledList(const UnrolledList& other)
+    requires std::copy_constructible<T>;
+  UnrolledList& operator=(const UnrolledList& other)
+    requires std::copy_constructible<T>;
+
+  UnrolledList(UnrolledList&& other) noexcept;
+  UnrolledList& operator=(UnrolledList&& other) noexcept;
+
+  UnrolledList(std::initializer_list<T> list)
+    requires std::copy_constructible<T>;
+
+  ~UnrolledList() noexcept;
+  void Clear();
+
+  template <typename... Args>
+  T& EmplaceBack(Args&&... args);
+  void PushBack(const T& val)
+    requires std::copy_constructible<T>;
+
+  template <typename... Args>
+  T& EmplaceFront(Args&&... args);
+  void PushFront(const T& val)
+    requires std::copy_constructible<T>;
+
+  // Inserts before `pos` and returns the iterator to the new element.
+  // Iterators to elements in the same node are invalidated.
+  template <typename... Args>
+  Iterator Emplace(Iterator pos, Args&&... args);
+  Iterator Insert(Iterator pos, const T& val)
+    requires std::copy_constructible<T>;
+
+  // Removes the element at `pos` and returns the iterator to the next one.
+  // Iterators to elements in the same or the next node are invalidated.
+  Iterator Remove(Iterator pos);
+
+  T PopBack();
+  T PopFront();
+
+  T& GetFront() const;
+  T& GetBack() const;
+
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+  // Walks the nodes, O(size / N).
+  [[nodiscard]] size_t GetNodeCnt() const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  static constexpr size_t kMinCnt = N / 2;
+
+  // Links a new empty node after `prev`, or at the front if `prev` is null.
+  Node* NewNodeAfter(Node* prev);
+  void DeleteNode(Node* node);
+  static void FreeNode(Node* node);
+
+  // Moves [index, cnt) one slot right and increases `cnt`.
+  static void OpenGap(Node* node, size_t index);
+  // Moves (index, cnt) one slot left and decreases `cnt`, the slot at `index`
+  // must already be destructed.
+  static void CloseGap(Node* node, size_t index);
+  // Moves `cnt` elements from the front of `src` to the back of `dst`.
+  static void MoveFront(Node* dst, Node* src, size_t cnt);
+
+  Node* head_{nullptr};
+  Node* tail_{nullptr};
+  size_t size_{0};
+};
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+struct UnrolledList<T, N>::Node {
+  Node* prev{nullptr};
+  Node* next{nullptr};
+  size_t cnt{0};
+  AlignedMemory<T> vals[N];
+
+  T* GetPtr(const size_t index) { return vals[index].GetPtr(); }
+};
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+class UnrolledList<T, N>::Iterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = Iterator;
+  using difference_type = ptrdiff_t;
+  using value_type = T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  Iterator() = default;
+  ~Iterator() = default;
+
+  Iterator(const Iterator& other) = default;
+  Iterator(Node* node, size_t index);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  friend class UnrolledList;
+  friend class ConstIterator;
+
+  Node* node_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+class UnrolledList<T, N>::ConstIterator {
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_type = ConstIterator;
+  using difference_type = ptrdiff_t;
+  using value_type = const T;
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  ConstIterator() = default;
+  ~ConstIterator() = default;
+
+  ConstIterator(const ConstIterator& other) = default;
+  ConstIterator(Node* node, size_t index);
+
+  // NOLINTNEXTLINE: Convert to const
+  ConstIterator(const Iterator& iter);
+
+  iterator_type& operator=(const iterator_type& other) = default;
+  reference operator*() const;
+  pointer operator->() const;
+  iterator_type& operator++();
+  iterator_type operator++(int);
+  bool operator==(const iterator_type& other) const;
+
+ private:
+  Node* node_{nullptr};
+  size_t index_{0};
+};
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::UnrolledList(const UnrolledList& other)
+  requires std::copy_constructible<T>
+{
+  for (const T& val : other) {
+    PushBack(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>& UnrolledList<T, N>::operator=(const UnrolledList& other)
+  requires std::copy_constructible<T>
+{
+  if (this != &other) {
+    Clear();
+    new (this) UnrolledList(other);
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::UnrolledList(UnrolledList&& other) noexcept
+    : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>& UnrolledList<T, N>::operator=(
+    UnrolledList&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    new (this) UnrolledList(std::move(other));
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::UnrolledList(std::initializer_list<T> list)
+  requires std::copy_constructible<T>
+{
+  for (const T& val : list) {
+    PushBack(val);
+  }
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::~UnrolledList() noexcept {
+  Clear();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::Clear() {
+  Node* node = head_;
+  while (node != nullptr) {
+    Node* next = node->next;
+    for (size_t i = 0; i < node->cnt; ++i) {
+      node->GetPtr(i)->~T();
+    }
+    FreeNode(node);
+    node = next;
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+  size_ = 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+template <typename... Args>
+T& UnrolledList<T, N>::EmplaceBack(Args&&... args) {
+  return *Emplace(end(), std::forward<Args>(args)...);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::PushBack(const T& val)
+  requires std::copy_constructible<T>
+{
+  EmplaceBack(T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+template <typename... Args>
+T& UnrolledList<T, N>::EmplaceFront(Args&&... args) {
+  return *Emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::PushFront(const T& val)
+  requires std::copy_constructible<T>
+{
+  EmplaceFront(T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+template <typename... Args>
+typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::Emplace(
+    Iterator pos, Args&&... args) {
+  Node* node = pos.node_;
+  size_t index = pos.index_;
+  if (node == nullptr) {
+    node = tail_ == nullptr ? NewNodeAfter(nullptr) : tail_;
+    index = node->cnt;
+  }
+  if (index == 0 && node->prev != nullptr && node->prev->cnt < N) {
+    node = node->prev;
+    index = node->cnt;
+  }
+  if (node->cnt == N) {
+    if (index == N) {
+      // Appending after a full node, start a new one instead of splitting.
+      node = NewNodeAfter(node);
+      index = 0;
+    } else {
+      Node* next = NewNodeAfter(node);
+      for (size_t i = kMinCnt; i < N; ++i) {
+        new (next->GetPtr(i - kMinCnt)) T(std::move(*node->GetPtr(i)));
+        node->GetPtr(i)->~T();
+      }
+      next->cnt = N - kMinCnt;
+      node->cnt = kMinCnt;
+      if (index > kMinCnt) {
+        index -= kMinCnt;
+        node = next;
+      }
+    }
+  }
+  OpenGap(node, index);
+  new (node->GetPtr(index)) T(std::forward<Args>(args)...);
+  ++size_;
+  return Iterator(node, index);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::Insert(
+    Iterator pos, const T& val)
+  requires std::copy_constructible<T>
+{
+  return Emplace(pos, T(val));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::Remove(
+    Iterator pos) {
+  Node* node = pos.node_;
+  const size_t index = pos.index_;
+  MIRAGE_DCHECK(node != nullptr && index < node->cnt);
+  node->GetPtr(index)->~T();
+  CloseGap(node, index);
+  --size_;
+
+  Node* next = node->next;
+  if (node->cnt == 0) {
+    DeleteNode(node);
+    return Iterator(next, 0);
+  }
+  if (node->cnt < kMinCnt && next != nullptr) {
+    if (node->cnt + next->cnt <= N) {
+      MoveFront(node, next, next->cnt);
+      DeleteNode(next);
+    } else {
+      MoveFront(node, next, 1);
+    }
+  }
+  if (index < node->cnt) {
+    return Iterator(node, index);
+  }
+  return Iterator(node->next, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+T UnrolledList<T, N>::PopBack() {
+  MIRAGE_DCHECK(size_ != 0);
+  const Iterator last(tail_, tail_->cnt - 1);
+  T val(std::move(*last));
+  Remove(last);
+  return val;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+T UnrolledList<T, N>::PopFront() {
+  MIRAGE_DCHECK(size_ != 0);
+  const Iterator first = begin();
+  T val(std::move(*first));
+  Remove(first);
+  return val;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+T& UnrolledList<T, N>::GetFront() const {
+  MIRAGE_DCHECK(size_ != 0);
+  return *head_->GetPtr(0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+T& UnrolledList<T, N>::GetBack() const {
+  MIRAGE_DCHECK(size_ != 0);
+  return *tail_->GetPtr(tail_->cnt - 1);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+size_t UnrolledList<T, N>::GetSize() const {
+  return size_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+bool UnrolledList<T, N>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+size_t UnrolledList<T, N>::GetNodeCnt() const {
+  size_t cnt = 0;
+  for (const Node* node = head_; node != nullptr; node = node->next) {
+    ++cnt;
+  }
+  return cnt;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::begin() {
+  return Iterator(head_, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::end() {
+  return Iterator();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator UnrolledList<T, N>::begin() const {
+  return ConstIterator(head_, 0);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator UnrolledList<T, N>::end() const {
+  return ConstIterator();
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Node* UnrolledList<T, N>::NewNodeAfter(
+    Node* prev) {
+  void* ptr = HeapAllocator::Get(MemoryTag::kList)
+                  .Allocate(sizeof(Node), alignof(Node));
+  Node* node = new (ptr) Node();
+  node->prev = prev;
+  node->next = prev == nullptr ? head_ : prev->next;
+  if (node->prev == nullptr) {
+    head_ = node;
+  } else {
+    node->prev->next = node;
+  }
+  if (node->next == nullptr) {
+    tail_ = node;
+  } else {
+    node->next->prev = node;
+  }
+  return node;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::DeleteNode(Node* node) {
+  MIRAGE_DCHECK(node->cnt == 0);
+  if (node->prev == nullptr) {
+    head_ = node->next;
+  } else {
+    node->prev->next = node->next;
+  }
+  if (node->next == nullptr) {
+    tail_ = node->prev;
+  } else {
+    node->next->prev = node->prev;
+  }
+  FreeNode(node);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::FreeNode(Node* node) {
+  node->~Node();
+  HeapAllocator::Get(MemoryTag::kList)
+      .Deallocate(node, sizeof(Node), alignof(Node));
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::OpenGap(Node* node, const size_t index) {
+  MIRAGE_DCHECK(node->cnt < N && index <= node->cnt);
+  for (size_t i = node->cnt; i > index; --i) {
+    new (node->GetPtr(i)) T(std::move(*node->GetPtr(i - 1)));
+    node->GetPtr(i - 1)->~T();
+  }
+  ++node->cnt;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::CloseGap(Node* node, const size_t index) {
+  for (size_t i = index + 1; i < node->cnt; ++i) {
+    new (node->GetPtr(i - 1)) T(std::move(*node->GetPtr(i)));
+    node->GetPtr(i)->~T();
+  }
+  --node->cnt;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+void UnrolledList<T, N>::MoveFront(Node* dst, Node* src, const size_t cnt) {
+  MIRAGE_DCHECK(dst->cnt + cnt <= N && cnt <= src->cnt);
+  for (size_t i = 0; i < cnt; ++i) {
+    new (dst->GetPtr(dst->cnt + i)) T(std::move(*src->GetPtr(i)));
+    src->GetPtr(i)->~T();
+  }
+  dst->cnt += cnt;
+  for (size_t i = cnt; i < src->cnt; ++i) {
+    new (src->GetPtr(i - cnt)) T(std::move(*src->GetPtr(i)));
+    src->GetPtr(i)->~T();
+  }
+  src->cnt -= cnt;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::Iterator::Iterator(Node* node, const size_t index)
+    : node_(node), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator::reference
+UnrolledList<T, N>::Iterator::operator*() const {
+  return *node_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator::pointer
+UnrolledList<T, N>::Iterator::operator->() const {
+  return node_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator::iterator_type&
+UnrolledList<T, N>::Iterator::operator++() {
+  ++index_;
+  if (index_ == node_->cnt) {
+    node_ = node_->next;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::Iterator::iterator_type
+UnrolledList<T, N>::Iterator::operator++(int) {
+  iterator_type temp(*this);
+  ++*this;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+bool UnrolledList<T, N>::Iterator::operator==(
+    const iterator_type& other) const {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::ConstIterator::ConstIterator(Node* node,
+                                                 const size_t index)
+    : node_(node), index_(index) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+UnrolledList<T, N>::ConstIterator::ConstIterator(const Iterator& iter)
+    : node_(iter.node_), index_(iter.index_) {}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator::reference
+UnrolledList<T, N>::ConstIterator::operator*() const {
+  return *node_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator::pointer
+UnrolledList<T, N>::ConstIterator::operator->() const {
+  return node_->GetPtr(index_);
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator::iterator_type&
+UnrolledList<T, N>::ConstIterator::operator++() {
+  ++index_;
+  if (index_ == node_->cnt) {
+    node_ = node_->next;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+typename UnrolledList<T, N>::ConstIterator::iterator_type
+UnrolledList<T, N>::ConstIterator::operator++(int) {
+  iterator_type temp(*this);
+  ++*this;
+  return temp;
+}
+
+template <std::move_constructible T, size_t N>
+  requires(N >= 2)
+bool UnrolledList<T, N>::ConstIterator::operator==(
+    const iterator_type& other) const {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_CONTAINER_UNROLLED_LIST
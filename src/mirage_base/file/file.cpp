@@ -0,0 +1,27 @@
+#include "mirage_base/file/file.hpp"
+
+#include <utility>
+
+using namespace mirage::base;
+
+File::File() : native_handle_(kInvalidHandle) {}
+
+File::File(const char* path, const Options options)
+    : native_handle_(Open(path, options)) {}
+
+File::File(File&& other) noexcept
+    : native_handle_(std::exchange(other.native_handle_, kInvalidHandle)) {}
+
+File& File::operator=(File&& other) noexcept {
+  if (this != &other) {
+    Close();
+    native_handle_ = std::exchange(other.native_handle_, kInvalidHandle);
+  }
+  return *this;
+}
+
+File::~File() { Close(); }
+
+bool File::IsValid() const { return native_handle_ != kInvalidHandle; }
+
+File::NativeHandle File::GetNativeHandle() const { return native_handle_; }
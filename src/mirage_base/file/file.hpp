@@ -0,0 +1,72 @@
+#ifndef MIRAGE_BASE_FILE_FILE
+#define MIRAGE_BASE_FILE_FILE
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/util/optional.hpp"
+
+namespace mirage::base {
+
+// Open file, closed on destruction. Reads and writes take an explicit offset
+// and do not move a shared file position.
+class MIRAGE_API File {
+ public:
+  using NativeHandle = intptr_t;
+
+  enum class Mode {
+    kRead,
+    // Creates the file or truncates an existing one.
+    kWrite,
+    // Creates the file if it is missing, keeps the content otherwise.
+    kReadWrite,
+  };
+
+  struct Options {
+    Mode mode{Mode::kRead};
+    // Bypasses the page cache. Buffers, offsets and sizes must then be
+    // multiples of `kDirectAlign`, except for the tail at the end of file.
+    bool direct{false};
+  };
+
+  static constexpr NativeHandle kInvalidHandle = -1;
+  static constexpr size_t kDirectAlign = 4096;
+
+  File();
+  // Check `IsValid` for whether the file could be opened.
+  File(const char* path, Options options);
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+
+  File(File&& other) noexcept;
+  File& operator=(File&& other) noexcept;
+  ~File();
+
+  [[nodiscard]] bool IsValid() const;
+
+  // Reads until `dst` is full or the end of file, returns none on failure.
+  [[nodiscard]] Optional<size_t> ReadAt(Span<std::byte> dst,
+                                        size_t offset) const;
+  // Writes all of `src`, returns false on failure.
+  [[nodiscard]] bool WriteAt(Span<const std::byte> src, size_t offset) const;
+
+  // Returns none on failure.
+  [[nodiscard]] Optional<size_t> GetSize() const;
+  // Truncates or zero extends the file.
+  [[nodiscard]] bool SetSize(size_t size) const;
+
+  [[nodiscard]] NativeHandle GetNativeHandle() const;
+
+ private:
+  static NativeHandle Open(const char* path, Options options);
+
+  void Close();
+
+  NativeHandle native_handle_;
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_FILE_FILE
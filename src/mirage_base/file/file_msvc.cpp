@@ -0,0 +1,112 @@
+#ifdef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/file/file.hpp"
+
+#include <windows.h>
+
+using namespace mirage::base;
+
+namespace {
+
+HANDLE ToHandle(const File::NativeHandle native_handle) {
+  return reinterpret_cast<HANDLE>(native_handle);
+}
+
+OVERLAPPED ToOverlapped(const size_t offset) {
+  OVERLAPPED overlapped{};
+  overlapped.Offset = static_cast<DWORD>(offset);
+  overlapped.OffsetHigh =
+      static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+  return overlapped;
+}
+
+}  // namespace
+
+File::NativeHandle File::Open(const char* path, const Options options) {
+  DWORD access = GENERIC_READ;
+  DWORD disposition = OPEN_EXISTING;
+  switch (options.mode) {
+    case Mode::kRead:
+      break;
+    case Mode::kWrite:
+      access = GENERIC_WRITE;
+      disposition = CREATE_ALWAYS;
+      break;
+    case Mode::kReadWrite:
+      access = GENERIC_READ | GENERIC_WRITE;
+      disposition = OPEN_ALWAYS;
+      break;
+  }
+  const DWORD flags = options.direct
+                          ? FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH
+                          : FILE_ATTRIBUTE_NORMAL;
+  HANDLE handle = CreateFileA(path, access, FILE_SHARE_READ, nullptr,
+                              disposition, flags, nullptr);
+  return handle == INVALID_HANDLE_VALUE
+             ? kInvalidHandle
+             : reinterpret_cast<NativeHandle>(handle);
+}
+
+Optional<size_t> File::ReadAt(const Span<std::byte> dst,
+                              const size_t offset) const {
+  size_t read = 0;
+  while (read < dst.GetSize()) {
+    OVERLAPPED overlapped = ToOverlapped(offset + read);
+    const size_t left = dst.GetSize() - read;
+    const DWORD size = left < MAXDWORD ? static_cast<DWORD>(left) : MAXDWORD;
+    DWORD cnt = 0;
+    if (!ReadFile(ToHandle(native_handle_), dst.GetRawPtr() + read, size,
+                  &cnt, &overlapped)) {
+      if (GetLastError() == ERROR_HANDLE_EOF) {
+        break;
+      }
+      return Optional<size_t>::None();
+    }
+    if (cnt == 0) {
+      break;
+    }
+    read += cnt;
+  }
+  return Optional<size_t>::New(read);
+}
+
+bool File::WriteAt(const Span<const std::byte> src,
+                   const size_t offset) const {
+  size_t written = 0;
+  while (written < src.GetSize()) {
+    OVERLAPPED overlapped = ToOverlapped(offset + written);
+    const size_t left = src.GetSize() - written;
+    const DWORD size = left < MAXDWORD ? static_cast<DWORD>(left) : MAXDWORD;
+    DWORD cnt = 0;
+    if (!WriteFile(ToHandle(native_handle_), src.GetRawPtr() + written, size,
+                   &cnt, &overlapped)) {
+      return false;
+    }
+    written += cnt;
+  }
+  return true;
+}
+
+Optional<size_t> File::GetSize() const {
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(ToHandle(native_handle_), &size)) {
+    return Optional<size_t>::None();
+  }
+  return Optional<size_t>::New(static_cast<size_t>(size.QuadPart));
+}
+
+bool File::SetSize(const size_t size) const {
+  FILE_END_OF_FILE_INFO info;
+  info.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+  return SetFileInformationByHandle(ToHandle(native_handle_), FileEndOfFileInfo,
+                                    &info, sizeof(info));
+}
+
+void File::Close() {
+  if (native_handle_ != kInvalidHandle) {
+    CloseHandle(ToHandle(native_handle_));
+    native_handle_ = kInvalidHandle;
+  }
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/file/file.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+using namespace mirage::base;
+
+namespace {
+
+int ToFd(const File::NativeHandle native_handle) {
+  return static_cast<int>(native_handle);
+}
+
+int GetFlags(const File::Mode mode) {
+  switch (mode) {
+    case File::Mode::kRead:
+      return O_RDONLY;
+    case File::Mode::kWrite:
+      return O_WRONLY | O_CREAT | O_TRUNC;
+    case File::Mode::kReadWrite:
+      return O_RDWR | O_CREAT;
+  }
+  return O_RDONLY;
+}
+
+}  // namespace
+
+File::NativeHandle File::Open(const char* path, const Options options) {
+  const int flags = GetFlags(options.mode) | O_CLOEXEC;
+  int fd = -1;
+#if defined(O_DIRECT)
+  if (options.direct) {
+    fd = open(path, flags | O_DIRECT, 0644);
+  }
+  // Some file systems, e.g. tmpfs, reject direct I/O.
+  if (fd == -1 && (!options.direct || errno == EINVAL)) {
+    fd = open(path, flags, 0644);
+  }
+#else
+  fd = open(path, flags, 0644);
+#if defined(F_NOCACHE)
+  if (fd != -1 && options.direct) {
+    fcntl(fd, F_NOCACHE, 1);
+  }
+#endif
+#endif
+  return fd == -1 ? kInvalidHandle : fd;
+}
+
+Optional<size_t> File::ReadAt(const Span<std::byte> dst,
+                              const size_t offset) const {
+  size_t read = 0;
+  while (read < dst.GetSize()) {
+    const ssize_t cnt =
+        pread(ToFd(native_handle_), dst.GetRawPtr() + read,
+              dst.GetSize() - read, static_cast<off_t>(offset + read));
+    if (cnt == -1 && errno == EINTR) {
+      continue;
+    }
+    if (cnt == -1) {
+      return Optional<size_t>::None();
+    }
+    if (cnt == 0) {
+      break;
+    }
+    read += static_cast<size_t>(cnt);
+  }
+  return Optional<size_t>::New(read);
+}
+
+bool File::WriteAt(const Span<const std::byte> src,
+                   const size_t offset) const {
+  size_t written = 0;
+  while (written < src.GetSize()) {
+    const ssize_t cnt =
+        pwrite(ToFd(native_handle_), src.GetRawPtr() + written,
+               src.GetSize() - written, static_cast<off_t>(offset + written));
+    if (cnt == -1 && errno == EINTR) {
+      continue;
+    }
+    if (cnt == -1) {
+      return false;
+    }
+    written += static_cast<size_t>(cnt);
+  }
+  return true;
+}
+
+Optional<size_t> File::GetSize() const {
+  struct stat info {};
+  if (fstat(ToFd(native_handle_), &info) == -1) {
+    return Optional<size_t>::None();
+  }
+  return Optional<size_t>::New(static_cast<size_t>(info.st_size));
+}
+
+bool File::SetSize(const size_t size) const {
+  return ftruncate(ToFd(native_handle_), static_cast<off_t>(size)) == 0;
+}
+
+void File::Close() {
+  if (native_handle_ != kInvalidHandle) {
+    close(ToFd(native_handle_));
+    native_handle_ = kInvalidHandle;
+  }
+}
+
+#endif
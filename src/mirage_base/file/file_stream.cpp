@@ -0,0 +1,162 @@
+#include "mirage_base/file/file_stream.hpp"
+
+#include <cstring>
+#include <utility>
+
+#include "mirage_base/memory/allocator.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+size_t AlignBufferSize(const size_t size) {
+  const size_t blocks = (size + File::kDirectAlign - 1) / File::kDirectAlign;
+  return (blocks == 0 ? 1 : blocks) * File::kDirectAlign;
+}
+
+std::byte* AllocateBuffer(const File& file, const size_t size) {
+  if (!file.IsValid()) {
+    return nullptr;
+  }
+  return static_cast<std::byte*>(
+      HeapAllocator::Get().Allocate(size, File::kDirectAlign));
+}
+
+void DeallocateBuffer(std::byte* buffer, const size_t size) {
+  if (buffer != nullptr) {
+    HeapAllocator::Get().Deallocate(buffer, size, File::kDirectAlign);
+  }
+}
+
+}  // namespace
+
+FileReader::FileReader(const char* path, const FileStreamOptions options)
+    : file_(path, {.mode = File::Mode::kRead, .direct = options.direct}),
+      buffer_size_(AlignBufferSize(options.buffer_size)) {
+  buffer_ = AllocateBuffer(file_, buffer_size_);
+}
+
+FileReader::FileReader(FileReader&& other) noexcept
+    : file_(std::move(other.file_)),
+      buffer_(std::exchange(other.buffer_, nullptr)),
+      buffer_size_(other.buffer_size_),
+      begin_(other.begin_),
+      end_(other.end_),
+      file_offset_(other.file_offset_),
+      offset_(other.offset_),
+      is_eof_(other.is_eof_),
+      is_failed_(other.is_failed_) {}
+
+FileReader::~FileReader() { DeallocateBuffer(buffer_, buffer_size_); }
+
+bool FileReader::IsValid() const { return file_.IsValid(); }
+
+size_t FileReader::Read(const Span<std::byte> dst) {
+  MIRAGE_DCHECK(IsValid());
+  size_t read = 0;
+  while (read < dst.GetSize()) {
+    if (begin_ == end_) {
+      if (is_eof_ || is_failed_) {
+        break;
+      }
+      Fill();
+      continue;
+    }
+    const size_t cnt = end_ - begin_ < dst.GetSize() - read
+                           ? end_ - begin_
+                           : dst.GetSize() - read;
+    std::memcpy(dst.GetRawPtr() + read, buffer_ + begin_, cnt);
+    begin_ += cnt;
+    read += cnt;
+  }
+  offset_ += read;
+  return read;
+}
+
+bool FileReader::IsEnd() const { return is_eof_ && begin_ == end_; }
+
+bool FileReader::IsFailed() const { return is_failed_; }
+
+size_t FileReader::GetOffset() const { return offset_; }
+
+void FileReader::Fill() {
+  Optional<size_t> cnt = file_.ReadAt({buffer_, buffer_size_}, file_offset_);
+  if (!cnt.IsValid()) {
+    is_failed_ = true;
+    return;
+  }
+  begin_ = 0;
+  end_ = cnt.Unwrap();
+  file_offset_ += end_;
+  is_eof_ = end_ < buffer_size_;
+}
+
+FileWriter::FileWriter(const char* path, const FileStreamOptions options)
+    : file_(path, {.mode = File::Mode::kWrite, .direct = options.direct}),
+      buffer_size_(AlignBufferSize(options.buffer_size)),
+      direct_(options.direct) {
+  buffer_ = AllocateBuffer(file_, buffer_size_);
+}
+
+FileWriter::FileWriter(FileWriter&& other) noexcept
+    : file_(std::move(other.file_)),
+      buffer_(std::exchange(other.buffer_, nullptr)),
+      buffer_size_(other.buffer_size_),
+      used_(std::exchange(other.used_, 0)),
+      file_offset_(other.file_offset_),
+      direct_(other.direct_),
+      is_failed_(other.is_failed_) {}
+
+FileWriter::~FileWriter() {
+  Flush();
+  DeallocateBuffer(buffer_, buffer_size_);
+}
+
+bool FileWriter::IsValid() const { return file_.IsValid(); }
+
+bool FileWriter::Write(const Span<const std::byte> src) {
+  MIRAGE_DCHECK(IsValid());
+  size_t written = 0;
+  while (!is_failed_ && written < src.GetSize()) {
+    const size_t cnt = buffer_size_ - used_ < src.GetSize() - written
+                           ? buffer_size_ - used_
+                           : src.GetSize() - written;
+    std::memcpy(buffer_ + used_, src.GetRawPtr() + written, cnt);
+    used_ += cnt;
+    written += cnt;
+    if (used_ == buffer_size_) {
+      Flush();
+    }
+  }
+  return !is_failed_;
+}
+
+bool FileWriter::Flush() {
+  if (is_failed_ || used_ == 0) {
+    return !is_failed_;
+  }
+  if (!direct_) {
+    is_failed_ = !file_.WriteAt({buffer_, used_}, file_offset_);
+    file_offset_ += used_;
+    used_ = 0;
+    return !is_failed_;
+  }
+
+  // Direct writes cover whole blocks. A partial last block is padded with
+  // zeros, cut off the file again and kept in the buffer until it fills up.
+  const size_t tail = used_ % File::kDirectAlign;
+  const size_t full = used_ - tail;
+  const size_t padded = tail == 0 ? full : full + File::kDirectAlign;
+  std::memset(buffer_ + used_, 0, padded - used_);
+  if (!file_.WriteAt({buffer_, padded}, file_offset_) ||
+      (tail != 0 && !file_.SetSize(file_offset_ + used_))) {
+    is_failed_ = true;
+    return false;
+  }
+  std::memmove(buffer_, buffer_ + full, tail);
+  file_offset_ += full;
+  used_ = tail;
+  return true;
+}
+
+size_t FileWriter::GetOffset() const { return file_offset_ + used_; }
@@ -0,0 +1,95 @@
+#ifndef MIRAGE_BASE_FILE_FILE_STREAM
+#define MIRAGE_BASE_FILE_FILE_STREAM
+
+#include <cstddef>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/file/file.hpp"
+
+namespace mirage::base {
+
+struct FileStreamOptions {
+  static constexpr size_t kDefaultBufferSize = 1024 * 1024;
+
+  // Rounded up to a multiple of `File::kDirectAlign`.
+  size_t buffer_size{kDefaultBufferSize};
+  // Moves data with direct I/O, which keeps a single pass over a large file
+  // from evicting the rest of the page cache.
+  bool direct{false};
+};
+
+// Reads a file front to back through one large page aligned buffer, so the
+// file is touched with few large reads however small the reads of the caller.
+class MIRAGE_API FileReader {
+ public:
+  // Check `IsValid` for whether the file could be opened.
+  explicit FileReader(const char* path, FileStreamOptions options = {});
+  FileReader(const FileReader&) = delete;
+  FileReader& operator=(const FileReader&) = delete;
+
+  FileReader(FileReader&& other) noexcept;
+  FileReader& operator=(FileReader&& other) = delete;
+  ~FileReader();
+
+  [[nodiscard]] bool IsValid() const;
+
+  // Fills `dst` up to the end of file, returns the bytes read. Fewer bytes
+  // than asked are only returned at the end of file or on failure.
+  size_t Read(Span<std::byte> dst);
+
+  [[nodiscard]] bool IsEnd() const;
+  [[nodiscard]] bool IsFailed() const;
+  // Bytes handed out so far.
+  [[nodiscard]] size_t GetOffset() const;
+
+ private:
+  void Fill();
+
+  File file_;
+  std::byte* buffer_{nullptr};
+  size_t buffer_size_;
+  size_t begin_{0};
+  size_t end_{0};
+  size_t file_offset_{0};
+  size_t offset_{0};
+  bool is_eof_{false};
+  bool is_failed_{false};
+};
+
+// Writes a file front to back through one large page aligned buffer. The
+// buffer is flushed when full, on `Flush` and on destruction.
+class MIRAGE_API FileWriter {
+ public:
+  // Creates the file or truncates an existing one. Check `IsValid` for
+  // whether it could be opened.
+  explicit FileWriter(const char* path, FileStreamOptions options = {});
+  FileWriter(const FileWriter&) = delete;
+  FileWriter& operator=(const FileWriter&) = delete;
+
+  FileWriter(FileWriter&& other) noexcept;
+  FileWriter& operator=(FileWriter&& other) = delete;
+  ~FileWriter();
+
+  [[nodiscard]] bool IsValid() const;
+
+  // Returns false once any write has failed.
+  bool Write(Span<const std::byte> src);
+  bool Flush();
+
+  // Bytes written so far.
+  [[nodiscard]] size_t GetOffset() const;
+
+ private:
+  File file_;
+  std::byte* buffer_{nullptr};
+  size_t buffer_size_;
+  size_t used_{0};
+  size_t file_offset_{0};
+  bool direct_;
+  bool is_failed_{false};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_FILE_FILE_STREAM
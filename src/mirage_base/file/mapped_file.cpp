@@ -0,0 +1,87 @@
+#include "mirage_base/file/mapped_file.hpp"
+
+#include <utility>
+
+using namespace mirage::base;
+
+namespace {
+
+File::Mode ToFileMode(const MappedFile::Access access) {
+  return access == MappedFile::Access::kRead ? File::Mode::kRead
+                                             : File::Mode::kReadWrite;
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const char* path) : MappedFile(path, Options()) {}
+
+MappedFile::MappedFile(const char* path, const Options options)
+    : file_(path, {.mode = ToFileMode(options.access)}),
+      access_(options.access) {
+  if (!file_.IsValid()) {
+    return;
+  }
+  Optional<size_t> size = file_.GetSize();
+  if (size.IsValid()) {
+    Map(size.Unwrap(), options);
+  }
+}
+
+MappedFile::MappedFile(const char* path, const size_t size, Options options)
+    : file_(path, {.mode = File::Mode::kReadWrite}),
+      access_(Access::kReadWrite) {
+  options.access = Access::kReadWrite;
+  if (file_.IsValid() && file_.SetSize(size)) {
+    Map(size, options);
+  }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : file_(std::move(other.file_)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      access_(other.access_) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Unmap();
+    file_ = std::move(other.file_);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    access_ = other.access_;
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() { Unmap(); }
+
+bool MappedFile::IsValid() const { return data_ != nullptr; }
+
+Span<const std::byte> MappedFile::GetBytes() const { return {data_, size_}; }
+
+Span<std::byte> MappedFile::GetWritableBytes() const {
+  MIRAGE_DCHECK(access_ == Access::kReadWrite);
+  return {data_, size_};
+}
+
+size_t MappedFile::GetSize() const { return size_; }
+
+MappedFile::Access MappedFile::GetAccess() const { return access_; }
+
+void MappedFile::Map(const size_t size, const Options options) {
+  if (size == 0) {
+    return;
+  }
+  data_ = MapView(file_, size, options);
+  if (data_ != nullptr) {
+    size_ = size;
+  }
+}
+
+void MappedFile::Unmap() {
+  if (data_ != nullptr) {
+    UnmapView(data_, size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+}
@@ -0,0 +1,82 @@
+#ifndef MIRAGE_BASE_FILE_MAPPED_FILE
+#define MIRAGE_BASE_FILE_MAPPED_FILE
+
+#include <cstddef>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/file/file.hpp"
+
+namespace mirage::base {
+
+// File mapped into memory, its content is read straight from the page cache
+// instead of being copied into a buffer. Writes to a read-write mapping reach
+// the file on `Flush` or when the mapping is destructed.
+class MIRAGE_API MappedFile {
+ public:
+  enum class Access {
+    kRead,
+    kReadWrite,
+  };
+
+  // Tells the kernel how the mapping is going to be touched, which drives
+  // read ahead and page reclaim.
+  enum class Advice {
+    kNormal,
+    kSequential,
+    kRandom,
+    // Start reading the range in now.
+    kWillNeed,
+  };
+
+  struct Options {
+    Access access{Access::kRead};
+    Advice advice{Advice::kNormal};
+    // Faults the whole file in while mapping, so that later access does not
+    // stall on the disk.
+    bool populate{false};
+  };
+
+  // Maps the whole file. Check `IsValid` for whether it could be opened,
+  // empty files can not be mapped.
+  explicit MappedFile(const char* path);
+  MappedFile(const char* path, Options options);
+  // Creates or resizes the file to `size` bytes and maps it read-write.
+  MappedFile(const char* path, size_t size, Options options);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  ~MappedFile();
+
+  [[nodiscard]] bool IsValid() const;
+
+  [[nodiscard]] Span<const std::byte> GetBytes() const;
+  // Only for `Access::kReadWrite`.
+  [[nodiscard]] Span<std::byte> GetWritableBytes() const;
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] Access GetAccess() const;
+
+  // Applies `advice` to the bytes of [offset, offset + size).
+  void Advise(Advice advice, size_t offset, size_t size) const;
+  // Writes dirty pages back to the file, returns false on failure.
+  [[nodiscard]] bool Flush() const;
+
+ private:
+  void Map(size_t size, Options options);
+  void Unmap();
+
+  // Returns null on failure.
+  static std::byte* MapView(const File& file, size_t size, Options options);
+  static void UnmapView(std::byte* data, size_t size);
+
+  File file_;
+  std::byte* data_{nullptr};
+  size_t size_{0};
+  Access access_;
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_FILE_MAPPED_FILE
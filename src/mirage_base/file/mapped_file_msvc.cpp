@@ -0,0 +1,58 @@
+#ifdef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/file/mapped_file.hpp"
+
+#include <windows.h>
+
+using namespace mirage::base;
+
+void MappedFile::Advise(const Advice advice, const size_t offset,
+                        const size_t size) const {
+  MIRAGE_DCHECK(offset <= size_ && size <= size_ - offset);
+  // Access patterns are fixed when the file is opened, only prefetching can
+  // be asked for afterwards.
+  if (advice == Advice::kWillNeed) {
+    WIN32_MEMORY_RANGE_ENTRY range{data_ + offset, size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+  }
+}
+
+bool MappedFile::Flush() const {
+  if (access_ == Access::kRead) {
+    return true;
+  }
+  return FlushViewOfFile(data_, size_) &&
+         FlushFileBuffers(reinterpret_cast<HANDLE>(file_.GetNativeHandle()));
+}
+
+std::byte* MappedFile::MapView(const File& file, const size_t size,
+                               const Options options) {
+  const bool is_writable = options.access == Access::kReadWrite;
+  const uint64_t size64 = size;
+  HANDLE mapping = CreateFileMappingA(
+      reinterpret_cast<HANDLE>(file.GetNativeHandle()), nullptr,
+      is_writable ? PAGE_READWRITE : PAGE_READONLY,
+      static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+  void* ptr = MapViewOfFile(mapping,
+                            is_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0,
+                            0, size);
+  // The view keeps the mapping object alive.
+  CloseHandle(mapping);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+  if (options.populate || options.advice == Advice::kWillNeed) {
+    WIN32_MEMORY_RANGE_ENTRY range{ptr, size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+  }
+  return static_cast<std::byte*>(ptr);
+}
+
+void MappedFile::UnmapView(std::byte* data, size_t /*size*/) {
+  UnmapViewOfFile(data);
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/file/mapped_file.hpp"
+
+#include <sys/mman.h>
+
+#include "mirage_base/memory/page_allocator.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+int ToMadvise(const MappedFile::Advice advice) {
+  switch (advice) {
+    case MappedFile::Advice::kNormal:
+      return MADV_NORMAL;
+    case MappedFile::Advice::kSequential:
+      return MADV_SEQUENTIAL;
+    case MappedFile::Advice::kRandom:
+      return MADV_RANDOM;
+    case MappedFile::Advice::kWillNeed:
+      return MADV_WILLNEED;
+  }
+  return MADV_NORMAL;
+}
+
+}  // namespace
+
+void MappedFile::Advise(const Advice advice, const size_t offset,
+                        const size_t size) const {
+  MIRAGE_DCHECK(offset <= size_ && size <= size_ - offset);
+  // The range has to start on a page boundary.
+  const size_t page_size = PageAllocator::GetPageSize();
+  const size_t begin = offset / page_size * page_size;
+  madvise(data_ + begin, size + offset - begin, ToMadvise(advice));
+}
+
+bool MappedFile::Flush() const {
+  return access_ == Access::kRead || msync(data_, size_, MS_SYNC) == 0;
+}
+
+std::byte* MappedFile::MapView(const File& file, const size_t size,
+                               const Options options) {
+  int prot = PROT_READ;
+  if (options.access == Access::kReadWrite) {
+    prot |= PROT_WRITE;
+  }
+  int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+  if (options.populate) {
+    flags |= MAP_POPULATE;
+  }
+#endif
+  void* ptr = mmap(nullptr, size, prot, flags,
+                   static_cast<int>(file.GetNativeHandle()), 0);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+  if (options.advice != Advice::kNormal) {
+    madvise(ptr, size, ToMadvise(options.advice));
+  }
+#if !defined(MAP_POPULATE)
+  if (options.populate) {
+    madvise(ptr, size, MADV_WILLNEED);
+  }
+#endif
+  return static_cast<std::byte*>(ptr);
+}
+
+void MappedFile::UnmapView(std::byte* data, const size_t size) {
+  munmap(data, size);
+}
+
+#endif
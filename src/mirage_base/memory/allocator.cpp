@@ -0,0 +1,75 @@
+#include "mirage_base/memory/allocator.hpp"
+
+#include <new>
+#include <utility>
+
+#include "mirage_base/memory/page_allocator.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+size_t RoundToPage(const size_t size) {
+  const size_t page_size = PageAllocator::GetPageSize();
+  return (size + page_size - 1) / page_size * page_size;
+}
+
+template <size_t... Is>
+HeapAllocator* NewHeapAllocators(std::index_sequence<Is...>) {
+  return new HeapAllocator[]{HeapAllocator(static_cast<MemoryTag>(Is))...};
+}
+
+}  // namespace
+
+HeapAllocator::HeapAllocator(const MemoryTag tag) : tag_(tag) {}
+
+void* HeapAllocator::Allocate(const size_t size, const size_t align) {
+  if (IsLarge(size, align)) {
+    void* ptr = PageAllocator::MapPages(
+        RoundToPage(size), PageAllocator::HugePages::kTransparent, false);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    MIRAGE_TRACK_ALLOCATE(tag_, size);
+    return ptr;
+  }
+  MIRAGE_TRACK_ALLOCATE(tag_, size);
+  return ::operator new(size, std::align_val_t(align));
+}
+
+void HeapAllocator::Deallocate(void* ptr, const size_t size,
+                               const size_t align) {
+  MIRAGE_TRACK_DEALLOCATE(tag_, size);
+  if (IsLarge(size, align)) {
+    PageAllocator::UnmapPages(ptr, RoundToPage(size));
+    return;
+  }
+  ::operator delete(ptr, size, std::align_val_t(align));
+}
+
+bool HeapAllocator::TryShrink(void* ptr, const size_t size,
+                              const size_t new_size, const size_t align) {
+  if (!IsLarge(size, align) || !IsLarge(new_size, align) ||
+      !PageAllocator::UnmapTail(ptr, RoundToPage(size),
+                                RoundToPage(new_size))) {
+    return false;
+  }
+  MIRAGE_TRACK_RESIZE(tag_, size, new_size);
+  return true;
+}
+
+MemoryTag HeapAllocator::GetTag() const {
+  return tag_;
+}
+
+HeapAllocator& HeapAllocator::Get(const MemoryTag tag) {
+  // Containers in other statics may still free memory during exit.
+  static HeapAllocator* const allocators =
+      NewHeapAllocators(std::make_index_sequence<kMemoryTagCnt>());
+  MIRAGE_DCHECK(tag < MemoryTag::kCnt);
+  return allocators[static_cast<size_t>(tag)];
+}
+
+bool HeapAllocator::IsLarge(const size_t size, const size_t align) {
+  return size >= kLargeSize && align <= PageAllocator::GetPageSize();
+}
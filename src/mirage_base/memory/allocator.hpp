@@ -0,0 +1,60 @@
+#ifndef MIRAGE_BASE_MEMORY_ALLOCATOR
+#define MIRAGE_BASE_MEMORY_ALLOCATOR
+
+#include <cstddef>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/memory_tracker.hpp"
+
+namespace mirage::base {
+
+// Source of raw memory for containers. `Deallocate` receives the same size and
+// alignment that were passed to `Allocate`, or the size of the last successful
+// `TryShrink` or `TryGrow`.
+class MIRAGE_API Allocator {
+ public:
+  virtual ~Allocator() = default;
+  virtual void* Allocate(size_t size, size_t align) = 0;
+  virtual void Deallocate(void* ptr, size_t size, size_t align) = 0;
+  // Releases the memory past `new_size` in place, returns false if the block
+  // has to be reallocated instead.
+  virtual bool TryShrink(void* /*ptr*/, size_t /*size*/, size_t /*new_size*/,
+                         size_t /*align*/) {
+    return false;
+  }
+  // Extends the block in place to `new_size`, returns false if it has to be
+  // reallocated instead.
+  virtual bool TryGrow(void* /*ptr*/, size_t /*size*/, size_t /*new_size*/,
+                       size_t /*align*/) {
+    return false;
+  }
+};
+
+// Global heap through aligned `operator new`, used when no allocator is given.
+// Blocks of `kLargeSize` and more are mapped from the OS with transparent huge
+// pages instead. Every allocation is accounted to the tag of the allocator.
+class MIRAGE_API HeapAllocator : public Allocator {
+ public:
+  static constexpr size_t kLargeSize = 4 * 1024 * 1024;
+
+  explicit HeapAllocator(MemoryTag tag = MemoryTag::kGeneral);
+  ~HeapAllocator() override = default;
+  void* Allocate(size_t size, size_t align) override;
+  void Deallocate(void* ptr, size_t size, size_t align) override;
+  bool TryShrink(void* ptr, size_t size, size_t new_size,
+                 size_t align) override;
+
+  [[nodiscard]] MemoryTag GetTag() const;
+
+  // Shared instance for `tag`, never destructed.
+  static HeapAllocator& Get(MemoryTag tag = MemoryTag::kGeneral);
+
+ private:
+  static bool IsLarge(size_t size, size_t align);
+
+  MemoryTag tag_;
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_MEMORY_ALLOCATOR
@@ -0,0 +1,156 @@
+#include "mirage_base/memory/arena.hpp"
+
+#include <bit>
+#include <cstdint>
+
+using namespace mirage::base;
+
+struct Arena::Chunk {
+  Chunk* next{nullptr};
+  size_t size{0};
+
+  std::byte* GetData() { return reinterpret_cast<std::byte*>(this + 1); }
+};
+
+Arena::Arena(const size_t chunk_size)
+    : Arena(chunk_size, HeapAllocator::Get(MemoryTag::kArena)) {}
+
+Arena::Arena(const size_t chunk_size, Allocator& backing)
+    : chunk_size_(chunk_size), backing_(&backing) {
+  MIRAGE_DCHECK(chunk_size != 0);
+}
+
+Arena::~Arena() {
+  RunDestructors(nullptr);
+  Chunk* chunk = head_;
+  while (chunk != nullptr) {
+    Chunk* next = chunk->next;
+    backing_->Deallocate(chunk, sizeof(Chunk) + chunk->size, alignof(Chunk));
+    chunk = next;
+  }
+}
+
+void* Arena::Allocate(const size_t size, const size_t align) {
+  MIRAGE_DCHECK(std::has_single_bit(align));
+  if (void* ptr = TryBump(size, align); ptr != nullptr) {
+    return ptr;
+  }
+  // Reuse chunks left behind by `Rewind` or `Reset` before growing.
+  while (current_ != nullptr && current_->next != nullptr) {
+    current_ = current_->next;
+    offset_ = 0;
+    if (void* ptr = TryBump(size, align); ptr != nullptr) {
+      return ptr;
+    }
+  }
+  AppendChunk(size + align > chunk_size_ ? size + align : chunk_size_);
+  return TryBump(size, align);
+}
+
+void Arena::Deallocate(void* ptr, const size_t size, size_t /*align*/) {
+  if (IsLatest(ptr, size)) {
+    offset_ = static_cast<std::byte*>(ptr) - current_->GetData();
+  }
+}
+
+bool Arena::TryShrink(void* ptr, const size_t size, const size_t new_size,
+                      size_t /*align*/) {
+  if (!IsLatest(ptr, size)) {
+    return false;
+  }
+  offset_ -= size - new_size;
+  return true;
+}
+
+bool Arena::TryGrow(void* ptr, const size_t size, const size_t new_size,
+                    size_t /*align*/) {
+  if (!IsLatest(ptr, size) || offset_ + (new_size - size) > current_->size) {
+    return false;
+  }
+  offset_ += new_size - size;
+  return true;
+}
+
+Arena::Marker Arena::Mark() const {
+  return {current_, offset_, destructors_};
+}
+
+void Arena::Rewind(const Marker& marker) {
+  RunDestructors(marker.destructor);
+  if (marker.chunk == nullptr) {
+    current_ = head_;
+    offset_ = 0;
+    return;
+  }
+  current_ = marker.chunk;
+  offset_ = marker.offset;
+}
+
+void Arena::Reset() {
+  Rewind(Marker());
+}
+
+size_t Arena::GetUsedSize() const {
+  if (current_ == nullptr) {
+    return 0;
+  }
+  size_t size = offset_;
+  for (const Chunk* chunk = head_; chunk != current_; chunk = chunk->next) {
+    size += chunk->size;
+  }
+  return size;
+}
+
+size_t Arena::GetReservedSize() const {
+  size_t size = 0;
+  for (const Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) {
+    size += chunk->size;
+  }
+  return size;
+}
+
+void* Arena::TryBump(const size_t size, const size_t align) {
+  if (current_ == nullptr) {
+    return nullptr;
+  }
+  const auto base = reinterpret_cast<uintptr_t>(current_->GetData());
+  const uintptr_t ptr = (base + offset_ + align - 1) & ~(align - 1);
+  if (ptr + size > base + current_->size) {
+    return nullptr;
+  }
+  offset_ = ptr + size - base;
+  return reinterpret_cast<void*>(ptr);
+}
+
+bool Arena::IsLatest(const void* ptr, const size_t size) const {
+  return current_ != nullptr &&
+         static_cast<const std::byte*>(ptr) + size ==
+             current_->GetData() + offset_;
+}
+
+void Arena::AppendChunk(const size_t size) {
+  void* ptr = backing_->Allocate(sizeof(Chunk) + size, alignof(Chunk));
+  auto* chunk = new (ptr) Chunk();
+  chunk->size = size;
+  if (current_ == nullptr) {
+    head_ = chunk;
+  } else {
+    current_->next = chunk;
+  }
+  current_ = chunk;
+  offset_ = 0;
+}
+
+void Arena::RunDestructors(const Destructor* until) {
+  while (destructors_ != until) {
+    Destructor* destructor = destructors_;
+    destructors_ = destructor->next;
+    destructor->destruct(destructor->obj);
+  }
+}
+
+ArenaScope::ArenaScope(Arena& arena) : arena_(arena), marker_(arena.Mark()) {}
+
+ArenaScope::~ArenaScope() {
+  arena_.Rewind(marker_);
+}
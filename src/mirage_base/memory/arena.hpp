@@ -0,0 +1,113 @@
+#ifndef MIRAGE_BASE_MEMORY_ARENA
+#define MIRAGE_BASE_MEMORY_ARENA
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+
+namespace mirage::base {
+
+// Bump pointer allocator over a chain of chunks. `Deallocate` only gives back
+// the latest allocation, other memory is reclaimed all at once by `Rewind` to
+// a `Mark` or by `Reset`.
+// Chunks are kept for reuse until the arena is destructed, so a per-frame
+// arena stops calling the heap after the first few frames.
+class MIRAGE_API Arena : public Allocator {
+ public:
+  struct Chunk;
+  struct Destructor;
+
+  // Position to rewind to, only valid while nothing before it is rewound.
+  struct Marker {
+    Chunk* chunk{nullptr};
+    size_t offset{0};
+    Destructor* destructor{nullptr};
+  };
+
+  static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+  explicit Arena(size_t chunk_size = kDefaultChunkSize);
+  // Takes chunks from `backing`, e.g. a `PageAllocator` for huge chunks.
+  Arena(size_t chunk_size, Allocator& backing);
+  ~Arena() override;
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  void* Allocate(size_t size, size_t align) override;
+  void Deallocate(void* ptr, size_t size, size_t align) override;
+  // Succeeds for the latest allocation.
+  bool TryShrink(void* ptr, size_t size, size_t new_size,
+                 size_t align) override;
+  // Succeeds for the latest allocation while its chunk has room.
+  bool TryGrow(void* ptr, size_t size, size_t new_size,
+               size_t align) override;
+
+  // Constructs a `T` in the arena. Non-trivial destructors are registered and
+  // run on `Rewind`, `Reset` or destruction, latest first.
+  template <typename T, typename... Args>
+  T* New(Args&&... args);
+
+  [[nodiscard]] Marker Mark() const;
+  void Rewind(const Marker& marker);
+  void Reset();
+
+  // Bytes handed out since the last reset, including alignment padding.
+  [[nodiscard]] size_t GetUsedSize() const;
+  // Bytes of all chunks owned by the arena.
+  [[nodiscard]] size_t GetReservedSize() const;
+
+ private:
+  void* TryBump(size_t size, size_t align);
+  [[nodiscard]] bool IsLatest(const void* ptr, size_t size) const;
+  void AppendChunk(size_t size);
+  void RunDestructors(const Destructor* until);
+
+  size_t chunk_size_;
+  Allocator* backing_;
+  Chunk* head_{nullptr};
+  Chunk* current_{nullptr};
+  size_t offset_{0};
+  Destructor* destructors_{nullptr};
+};
+
+struct Arena::Destructor {
+  void (*destruct)(void* obj);
+  void* obj;
+  Destructor* next;
+};
+
+// Rewinds the arena to where it was when the scope was entered.
+class MIRAGE_API ArenaScope {
+ public:
+  ArenaScope() = delete;
+  ArenaScope(const ArenaScope&) = delete;
+
+  explicit ArenaScope(Arena& arena);
+  ~ArenaScope();
+
+ private:
+  Arena& arena_;
+  Arena::Marker marker_;
+};
+
+template <typename T, typename... Args>
+T* Arena::New(Args&&... args) {
+  T* obj = new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    void* ptr = Allocate(sizeof(Destructor), alignof(Destructor));
+    destructors_ = new (ptr) Destructor{
+        [](void* ptr) { static_cast<T*>(ptr)->~T(); }, obj, destructors_};
+  }
+  return obj;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_MEMORY_ARENA
@@ -0,0 +1,177 @@
+#include "mirage_base/memory/memory_tracker.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#include "mirage_base/util/cache_line_padded.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+constexpr size_t kShardCnt = 16;
+// Every 64th allocation of a shard folds all shards into the peak, and so
+// does every allocation of `kPeakExactSize` or more. Summing the shards costs
+// little next to a large allocation, and large short-lived buffers are the
+// spikes the peak is for.
+constexpr uint64_t kPeakSampleMask = 63;
+constexpr size_t kPeakExactSize = 4096;
+
+struct Shard {
+  std::atomic<int64_t> live_size{0};
+  std::atomic<uint64_t> alloc_cnt{0};
+  std::atomic<uint64_t> dealloc_cnt{0};
+};
+
+struct TagCounters {
+  CacheLinePadded<Shard> shards[kShardCnt];
+  CacheLinePadded<std::atomic<int64_t>> peak_size;
+};
+
+TagCounters g_counters[kMemoryTagCnt];
+
+TagCounters& GetCounters(const MemoryTag tag) {
+  MIRAGE_DCHECK(tag < MemoryTag::kCnt);
+  return g_counters[static_cast<size_t>(tag)];
+}
+
+size_t GetShardIndex() {
+  static std::atomic<size_t> next_index{0};
+  thread_local const size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kShardCnt;
+  return index;
+}
+
+int64_t GetLiveSize(const TagCounters& counters) {
+  int64_t size = 0;
+  for (const CacheLinePadded<Shard>& shard : counters.shards) {
+    size += shard->live_size.load(std::memory_order_relaxed);
+  }
+  return size;
+}
+
+void UpdatePeak(TagCounters& counters, const int64_t size) {
+  int64_t peak = counters.peak_size->load(std::memory_order_relaxed);
+  while (peak < size && !counters.peak_size->compare_exchange_weak(
+                            peak, size, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+double MemoryTracker::Snapshot::GetAllocRate(const Snapshot& earlier,
+                                             const MemoryTag tag) const {
+  const std::chrono::duration<double> duration = time - earlier.time;
+  if (duration.count() <= 0) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(tag);
+  const uint64_t cnt =
+      stats[index].alloc_cnt - earlier.stats[index].alloc_cnt;
+  return static_cast<double>(cnt) / duration.count();
+}
+
+void MemoryTracker::OnAllocate(const MemoryTag tag, const size_t size) {
+  TagCounters& counters = GetCounters(tag);
+  Shard& shard = *counters.shards[GetShardIndex()];
+  shard.live_size.fetch_add(static_cast<int64_t>(size),
+                            std::memory_order_relaxed);
+  const uint64_t cnt = shard.alloc_cnt.fetch_add(1, std::memory_order_relaxed);
+  if (size >= kPeakExactSize || (cnt & kPeakSampleMask) == 0) {
+    UpdatePeak(counters, GetLiveSize(counters));
+  }
+}
+
+void MemoryTracker::OnDeallocate(const MemoryTag tag, const size_t size) {
+  Shard& shard = *GetCounters(tag).shards[GetShardIndex()];
+  shard.live_size.fetch_sub(static_cast<int64_t>(size),
+                            std::memory_order_relaxed);
+  shard.dealloc_cnt.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::OnResize(const MemoryTag tag, const size_t size,
+                             const size_t new_size) {
+  TagCounters& counters = GetCounters(tag);
+  Shard& shard = *counters.shards[GetShardIndex()];
+  shard.live_size.fetch_add(
+      static_cast<int64_t>(new_size) - static_cast<int64_t>(size),
+      std::memory_order_relaxed);
+  if (new_size >= size + kPeakExactSize) {
+    UpdatePeak(counters, GetLiveSize(counters));
+  }
+}
+
+MemoryTracker::Stats MemoryTracker::GetStats(const MemoryTag tag) {
+  TagCounters& counters = GetCounters(tag);
+  Stats stats;
+  for (const CacheLinePadded<Shard>& shard : counters.shards) {
+    stats.alloc_cnt += shard->alloc_cnt.load(std::memory_order_relaxed);
+    stats.dealloc_cnt += shard->dealloc_cnt.load(std::memory_order_relaxed);
+  }
+  // Shards are read one by one, so the sum may briefly be off or negative.
+  const int64_t live_size = GetLiveSize(counters);
+  UpdatePeak(counters, live_size);
+  stats.live_size = live_size < 0 ? 0 : static_cast<size_t>(live_size);
+  stats.peak_size = static_cast<size_t>(
+      counters.peak_size->load(std::memory_order_relaxed));
+  return stats;
+}
+
+MemoryTracker::Snapshot MemoryTracker::TakeSnapshot() {
+  Snapshot snapshot;
+  snapshot.time = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kMemoryTagCnt; ++i) {
+    snapshot.stats[i] = GetStats(static_cast<MemoryTag>(i));
+  }
+  return snapshot;
+}
+
+const char* MemoryTracker::GetTagName(const MemoryTag tag) {
+  switch (tag) {
+    case MemoryTag::kGeneral:
+      return "General";
+    case MemoryTag::kArray:
+      return "Array";
+    case MemoryTag::kList:
+      return "List";
+    case MemoryTag::kHashMap:
+      return "HashMap";
+    case MemoryTag::kRBTree:
+      return "RBTree";
+    case MemoryTag::kOwned:
+      return "Owned";
+    case MemoryTag::kArena:
+      return "Arena";
+    case MemoryTag::kPool:
+      return "Pool";
+    case MemoryTag::kScratch:
+      return "Scratch";
+    case MemoryTag::kString:
+      return "String";
+    case MemoryTag::kCnt:
+      break;
+  }
+  return "Unknown";
+}
+
+bool MemoryTracker::ReportLeaks() {
+  bool is_leaked = false;
+  for (size_t i = 0; i < kMemoryTagCnt; ++i) {
+    const auto tag = static_cast<MemoryTag>(i);
+    const Stats stats = GetStats(tag);
+    if (stats.live_size == 0) {
+      continue;
+    }
+    is_leaked = true;
+    std::fprintf(stderr, "[mirage] %s: %zu bytes live in %llu allocations\n",
+                 GetTagName(tag), stats.live_size,
+                 static_cast<unsigned long long>(stats.alloc_cnt -
+                                                 stats.dealloc_cnt));
+  }
+  return is_leaked;
+}
+
+void MemoryTracker::ReportLeaksAtExit() {
+  std::atexit([] { ReportLeaks(); });
+}
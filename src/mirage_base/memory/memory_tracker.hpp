@@ -0,0 +1,91 @@
+#ifndef MIRAGE_BASE_MEMORY_MEMORY_TRACKER
+#define MIRAGE_BASE_MEMORY_MEMORY_TRACKER
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Subsystem an allocation is accounted to.
+enum class MemoryTag : uint8_t {
+  kGeneral,
+  kArray,
+  kList,
+  kHashMap,
+  kRBTree,
+  kOwned,
+  kArena,
+  kPool,
+  kScratch,
+  kString,
+  kCnt,
+};
+
+constexpr size_t kMemoryTagCnt = static_cast<size_t>(MemoryTag::kCnt);
+
+// Per tag allocation counters, sharded by thread so that concurrent updates
+// rarely share a cache line. Only updated when built with
+// `MIRAGE_MEMORY_TRACKING`, otherwise the hooks compile to nothing and every
+// counter stays zero.
+class MIRAGE_API MemoryTracker {
+ public:
+  struct Stats {
+    size_t live_size{0};
+    // Exact when reached by an allocation of a page or more, otherwise
+    // sampled and may miss spikes made of many small allocations.
+    size_t peak_size{0};
+    uint64_t alloc_cnt{0};
+    uint64_t dealloc_cnt{0};
+  };
+
+  struct Snapshot {
+    std::chrono::steady_clock::time_point time;
+    Stats stats[kMemoryTagCnt];
+
+    // Allocations per second of `tag` since `earlier`.
+    [[nodiscard]] double GetAllocRate(const Snapshot& earlier,
+                                      MemoryTag tag) const;
+  };
+
+#if defined(MIRAGE_MEMORY_TRACKING)
+  static constexpr bool kIsEnabled = true;
+#else
+  static constexpr bool kIsEnabled = false;
+#endif
+
+  MemoryTracker() = delete;
+
+  static void OnAllocate(MemoryTag tag, size_t size);
+  static void OnDeallocate(MemoryTag tag, size_t size);
+  // An allocation changed size in place.
+  static void OnResize(MemoryTag tag, size_t size, size_t new_size);
+
+  static Stats GetStats(MemoryTag tag);
+  static Snapshot TakeSnapshot();
+  static const char* GetTagName(MemoryTag tag);
+
+  // Prints every tag with live memory to stderr, returns whether any exists.
+  static bool ReportLeaks();
+  // Calls `ReportLeaks` when the process exits normally.
+  static void ReportLeaksAtExit();
+};
+
+}  // namespace mirage::base
+
+#if defined(MIRAGE_MEMORY_TRACKING)
+#define MIRAGE_TRACK_ALLOCATE(tag, size) \
+  ::mirage::base::MemoryTracker::OnAllocate(tag, size)
+#define MIRAGE_TRACK_DEALLOCATE(tag, size) \
+  ::mirage::base::MemoryTracker::OnDeallocate(tag, size)
+#define MIRAGE_TRACK_RESIZE(tag, size, new_size) \
+  ::mirage::base::MemoryTracker::OnResize(tag, size, new_size)
+#else
+#define MIRAGE_TRACK_ALLOCATE(tag, size) ((void)0)
+#define MIRAGE_TRACK_DEALLOCATE(tag, size) ((void)0)
+#define MIRAGE_TRACK_RESIZE(tag, size, new_size) ((void)0)
+#endif
+
+#endif  // MIRAGE_BASE_MEMORY_MEMORY_TRACKER
@@ -0,0 +1,49 @@
+#include "mirage_base/memory/page_allocator.hpp"
+
+#include <new>
+
+using namespace mirage::base;
+
+PageAllocator::PageAllocator() : PageAllocator(Options()) {}
+
+PageAllocator::PageAllocator(const Options options, const MemoryTag tag)
+    : options_(options), tag_(tag) {}
+
+void* PageAllocator::Allocate(const size_t size, const size_t align) {
+  MIRAGE_DCHECK(align <= GetPageSize());
+  const size_t mapped_size = GetMappedSize(size);
+  void* ptr = MapPages(mapped_size, options_.huge_pages, options_.prefault);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  MIRAGE_TRACK_ALLOCATE(tag_, mapped_size);
+  return ptr;
+}
+
+void PageAllocator::Deallocate(void* ptr, const size_t size,
+                               size_t /*align*/) {
+  if (ptr == nullptr) {
+    return;
+  }
+  const size_t mapped_size = GetMappedSize(size);
+  MIRAGE_TRACK_DEALLOCATE(tag_, mapped_size);
+  UnmapPages(ptr, mapped_size);
+}
+
+bool PageAllocator::TryShrink(void* ptr, const size_t size,
+                              const size_t new_size, size_t /*align*/) {
+  const size_t mapped_size = GetMappedSize(size);
+  const size_t new_mapped_size = GetMappedSize(new_size);
+  if (new_size == 0 || !UnmapTail(ptr, mapped_size, new_mapped_size)) {
+    return false;
+  }
+  MIRAGE_TRACK_RESIZE(tag_, mapped_size, new_mapped_size);
+  return true;
+}
+
+size_t PageAllocator::GetMappedSize(const size_t size) const {
+  const size_t granularity = options_.huge_pages == HugePages::kExplicit
+                                 ? kHugePageSize
+                                 : GetPageSize();
+  return (size + granularity - 1) / granularity * granularity;
+}
@@ -0,0 +1,67 @@
+#ifndef MIRAGE_BASE_MEMORY_PAGE_ALLOCATOR
+#define MIRAGE_BASE_MEMORY_PAGE_ALLOCATOR
+
+#include <cstddef>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+#include "mirage_base/memory/memory_tracker.hpp"
+
+namespace mirage::base {
+
+// Maps whole pages straight from the OS, meant for buffers of megabytes and
+// more. Huge pages cut TLB misses on random access, prefaulting moves the page
+// faults of a growing buffer to the allocation.
+class MIRAGE_API PageAllocator : public Allocator {
+ public:
+  enum class HugePages {
+    kNone,
+    // Ask the kernel to back the range with transparent huge pages.
+    kTransparent,
+    // Take pages from the reserved huge page pool, falls back to
+    // `kTransparent` when the pool is exhausted.
+    kExplicit,
+  };
+
+  struct Options {
+    HugePages huge_pages{HugePages::kTransparent};
+    bool prefault{false};
+  };
+
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+  PageAllocator();
+  explicit PageAllocator(Options options,
+                         MemoryTag tag = MemoryTag::kGeneral);
+  ~PageAllocator() override = default;
+
+  // `align` must not exceed the page size.
+  void* Allocate(size_t size, size_t align) override;
+  void Deallocate(void* ptr, size_t size, size_t align) override;
+  // Unmaps the pages past `new_size`.
+  bool TryShrink(void* ptr, size_t size, size_t new_size,
+                 size_t align) override;
+
+  // Size of the mapping made for a request of `size` bytes.
+  [[nodiscard]] size_t GetMappedSize(size_t size) const;
+
+  // Maps at least `size` bytes, `size` must be a multiple of the page size or
+  // of `kHugePageSize` for `HugePages::kExplicit`. Returns null on failure.
+  static void* MapPages(size_t size, HugePages huge_pages, bool prefault);
+  static void UnmapPages(void* ptr, size_t size);
+  // Gives the pages of `size` bytes past `new_size` back to the OS, returns
+  // false if the platform can not split a mapping or the unmap fails.
+  static bool UnmapTail(void* ptr, size_t size, size_t new_size);
+  // Drops the physical pages of the range but keeps it mapped, it reads back
+  // as zero afterwards.
+  static void Decommit(void* ptr, size_t size);
+  static size_t GetPageSize();
+
+ private:
+  Options options_;
+  MemoryTag tag_;
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_MEMORY_PAGE_ALLOCATOR
@@ -0,0 +1,54 @@
+#ifdef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/memory/page_allocator.hpp"
+
+#include <windows.h>
+
+using namespace mirage::base;
+
+void* PageAllocator::MapPages(const size_t size, const HugePages huge_pages,
+                              const bool prefault) {
+  void* ptr = nullptr;
+  if (huge_pages == HugePages::kExplicit) {
+    ptr = VirtualAlloc(nullptr, size,
+                       MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                       PAGE_READWRITE);
+  }
+  if (ptr == nullptr) {
+    ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT,
+                       PAGE_READWRITE);
+  }
+  if (ptr != nullptr && prefault) {
+    const size_t page_size = GetPageSize();
+    for (size_t offset = 0; offset < size; offset += page_size) {
+      static_cast<volatile char*>(ptr)[offset] = 0;
+    }
+  }
+  return ptr;
+}
+
+void PageAllocator::UnmapPages(void* ptr, size_t /*size*/) {
+  VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+bool PageAllocator::UnmapTail(void* /*ptr*/, size_t /*size*/,
+                              size_t /*new_size*/) {
+  // A reservation can only be released as a whole.
+  return false;
+}
+
+void PageAllocator::Decommit(void* ptr, const size_t size) {
+  VirtualFree(ptr, size, MEM_DECOMMIT);
+  VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
+}
+
+size_t PageAllocator::GetPageSize() {
+  static const size_t page_size = [] {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+  }();
+  return page_size;
+}
+
+#endif
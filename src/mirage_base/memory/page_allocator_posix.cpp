@@ -0,0 +1,80 @@
+#ifndef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/memory/page_allocator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace mirage::base;
+
+namespace {
+
+constexpr int kProt = PROT_READ | PROT_WRITE;
+constexpr int kFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_POPULATE)
+constexpr int kPopulate = MAP_POPULATE;
+#else
+constexpr int kPopulate = 0;
+#endif
+
+void* Map(const size_t size, const int flags) {
+  void* ptr = mmap(nullptr, size, kProt, flags, -1, 0);
+  return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+}  // namespace
+
+void* PageAllocator::MapPages(const size_t size, const HugePages huge_pages,
+                              const bool prefault) {
+  const int populate = prefault ? kPopulate : 0;
+#if defined(MAP_HUGETLB)
+  if (huge_pages == HugePages::kExplicit) {
+    if (void* ptr = Map(size, kFlags | MAP_HUGETLB | populate);
+        ptr != nullptr) {
+      return ptr;
+    }
+  }
+#endif
+  if (huge_pages == HugePages::kNone) {
+    return Map(size, kFlags | populate);
+  }
+
+  // Advise before the pages are faulted in, so they come as huge pages.
+  void* ptr = Map(size, kFlags);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+#if defined(MADV_HUGEPAGE)
+  madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+  if (prefault) {
+    const size_t page_size = GetPageSize();
+    for (size_t offset = 0; offset < size; offset += page_size) {
+      static_cast<volatile char*>(ptr)[offset] = 0;
+    }
+  }
+  return ptr;
+}
+
+void PageAllocator::UnmapPages(void* ptr, const size_t size) {
+  munmap(ptr, size);
+}
+
+bool PageAllocator::UnmapTail(void* ptr, const size_t size,
+                              const size_t new_size) {
+  if (new_size >= size) {
+    return true;
+  }
+  return munmap(static_cast<std::byte*>(ptr) + new_size, size - new_size) == 0;
+}
+
+void PageAllocator::Decommit(void* ptr, const size_t size) {
+  madvise(ptr, size, MADV_DONTNEED);
+}
+
+size_t PageAllocator::GetPageSize() {
+  static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef MIRAGE_BASE_MEMORY_POOL_ALLOCATOR
+#define MIRAGE_BASE_MEMORY_POOL_ALLOCATOR
+
+#include <cstddef>
+#include <new>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/treiber_stack.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+#include "mirage_base/synchronize/lock.hpp"
+
+namespace mirage::base {
+
+// Process wide pool of fixed size blocks. Each thread keeps a cache of free
+// blocks and only touches shared state when the cache runs empty or grows past
+// two magazines, in which case whole magazines move through a lock-free depot.
+// Blocks freed on another thread simply join that thread's cache. New blocks
+// are carved from page aligned slabs, which are never returned to the heap.
+template <size_t SIZE, size_t ALIGN = alignof(std::max_align_t)>
+class PoolAllocator final : public Allocator {
+ private:
+  struct Block {
+    Block* next;
+  };
+
+ public:
+  static constexpr size_t kPageSize = 4096;
+  static constexpr size_t kSlabSize = 64 * 1024;
+  static constexpr size_t kAlign =
+      ALIGN > alignof(Block) ? ALIGN : alignof(Block);
+  static constexpr size_t kBlockSize =
+      ((SIZE > sizeof(Block) ? SIZE : sizeof(Block)) + kAlign - 1) /
+      kAlign * kAlign;
+  static constexpr size_t kMagazineCnt =
+      kSlabSize / kBlockSize < 32 ? kSlabSize / kBlockSize : 32;
+
+  static_assert(kAlign <= kPageSize && kBlockSize <= kSlabSize);
+
+  PoolAllocator(const PoolAllocator&) = delete;
+  PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+  // Requests that do not fit a block, e.g. an `Array` growing past one, go to
+  // the heap and are freed there by the matching `Deallocate`.
+  void* Allocate(size_t size, size_t align) override;
+  void Deallocate(void* ptr, size_t size, size_t align) override;
+
+  // Bytes of all slabs carved so far.
+  [[nodiscard]] size_t GetReservedSize();
+
+  static PoolAllocator& Get();
+
+ private:
+  struct Magazine {
+    Block* head{nullptr};
+    size_t cnt{0};
+  };
+
+  // Per thread free blocks, handed back to the depot when the thread exits.
+  struct Cache {
+    Magazine magazine;
+
+    Cache() = default;
+    ~Cache();
+  };
+
+  PoolAllocator() = default;
+  ~PoolAllocator() override = default;
+
+  void Refill(Magazine& magazine);
+  void Spill(Magazine& magazine);
+  Magazine Carve();
+
+  static bool IsOversized(size_t size, size_t align);
+  static Magazine& GetCache();
+
+  TreiberStack<Magazine> depot_;
+  Lock lock_{"PoolAllocator"};
+  Array<std::byte*> slabs_;
+  size_t slab_offset_{kSlabSize};
+};
+
+// Pool whose blocks fit a `T`.
+template <typename T>
+using PoolAllocatorFor = PoolAllocator<sizeof(T), alignof(T)>;
+
+template <size_t SIZE, size_t ALIGN>
+void* PoolAllocator<SIZE, ALIGN>::Allocate(const size_t size,
+                                           const size_t align) {
+  if (IsOversized(size, align)) {
+    return HeapAllocator::Get(MemoryTag::kPool).Allocate(size, align);
+  }
+  Magazine& magazine = GetCache();
+  if (magazine.head == nullptr) {
+    Refill(magazine);
+  }
+  Block* block = magazine.head;
+  magazine.head = block->next;
+  --magazine.cnt;
+  return block;
+}
+
+template <size_t SIZE, size_t ALIGN>
+void PoolAllocator<SIZE, ALIGN>::Deallocate(void* ptr, const size_t size,
+                                            const size_t align) {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (IsOversized(size, align)) {
+    HeapAllocator::Get(MemoryTag::kPool).Deallocate(ptr, size, align);
+    return;
+  }
+  Magazine& magazine = GetCache();
+  magazine.head = new (ptr) Block{magazine.head};
+  ++magazine.cnt;
+  if (magazine.cnt >= 2 * kMagazineCnt) {
+    Spill(magazine);
+  }
+}
+
+template <size_t SIZE, size_t ALIGN>
+size_t PoolAllocator<SIZE, ALIGN>::GetReservedSize() {
+  LockGuard guard(lock_);
+  return slabs_.GetSize() * kSlabSize;
+}
+
+template <size_t SIZE, size_t ALIGN>
+PoolAllocator<SIZE, ALIGN>& PoolAllocator<SIZE, ALIGN>::Get() {
+  // Never destructed, thread caches may flush into it during exit.
+  static auto* pool = new PoolAllocator();
+  return *pool;
+}
+
+template <size_t SIZE, size_t ALIGN>
+PoolAllocator<SIZE, ALIGN>::Cache::~Cache() {
+  if (magazine.head != nullptr) {
+    Get().depot_.Emplace(magazine);
+  }
+}
+
+template <size_t SIZE, size_t ALIGN>
+void PoolAllocator<SIZE, ALIGN>::Refill(Magazine& magazine) {
+  Optional<Magazine> full = depot_.TryPop();
+  magazine = full.IsValid() ? full.Unwrap() : Carve();
+}
+
+template <size_t SIZE, size_t ALIGN>
+void PoolAllocator<SIZE, ALIGN>::Spill(Magazine& magazine) {
+  // Keep the most recently freed blocks, they are likely still in cache.
+  Block* last = magazine.head;
+  for (size_t i = 1; i < kMagazineCnt; ++i) {
+    last = last->next;
+  }
+  Magazine spilled = {last->next, magazine.cnt - kMagazineCnt};
+  last->next = nullptr;
+  magazine.cnt = kMagazineCnt;
+  depot_.Emplace(spilled);
+}
+
+template <size_t SIZE, size_t ALIGN>
+typename PoolAllocator<SIZE, ALIGN>::Magazine
+PoolAllocator<SIZE, ALIGN>::Carve() {
+  LockGuard guard(lock_);
+  if (slab_offset_ + kMagazineCnt * kBlockSize > kSlabSize) {
+    slabs_.Push(static_cast<std::byte*>(
+        HeapAllocator::Get(MemoryTag::kPool).Allocate(kSlabSize, kPageSize)));
+    slab_offset_ = 0;
+  }
+  std::byte* slab = slabs_[slabs_.GetSize() - 1];
+  Magazine magazine;
+  for (size_t i = 0; i < kMagazineCnt; ++i) {
+    magazine.head = new (slab + slab_offset_) Block{magazine.head};
+    slab_offset_ += kBlockSize;
+  }
+  magazine.cnt = kMagazineCnt;
+  return magazine;
+}
+
+template <size_t SIZE, size_t ALIGN>
+bool PoolAllocator<SIZE, ALIGN>::IsOversized(const size_t size,
+                                             const size_t align) {
+  return size > kBlockSize || align > kAlign;
+}
+
+template <size_t SIZE, size_t ALIGN>
+typename PoolAllocator<SIZE, ALIGN>::Magazine&
+PoolAllocator<SIZE, ALIGN>::GetCache() {
+  thread_local Cache cache;
+  return cache.magazine;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_MEMORY_POOL_ALLOCATOR
@@ -0,0 +1,11 @@
+#include "mirage_base/memory/scratch_allocator.hpp"
+
+using namespace mirage::base;
+
+Arena& ScratchAllocator::Get() {
+  thread_local Arena arena(kChunkSize,
+                           HeapAllocator::Get(MemoryTag::kScratch));
+  return arena;
+}
+
+ScratchScope::ScratchScope() : scope_(ScratchAllocator::Get()) {}
@@ -0,0 +1,55 @@
+#ifndef MIRAGE_BASE_MEMORY_SCRATCH_ALLOCATOR
+#define MIRAGE_BASE_MEMORY_SCRATCH_ALLOCATOR
+
+#include <concepts>
+#include <cstddef>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/arena.hpp"
+
+namespace mirage::base {
+
+// Per thread stack of temporary buffers. Allocations are bumped from a thread
+// local arena whose chunks stay around between uses, and are reclaimed in LIFO
+// order by the enclosing `ScratchScope`. Memory from it must not escape the
+// scope or the thread.
+// Not usable from destructors of static objects: thread locals of the main
+// thread are destructed before them.
+class MIRAGE_API ScratchAllocator {
+ public:
+  ScratchAllocator() = delete;
+
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  // Arena of the calling thread.
+  static Arena& Get();
+};
+
+// Rewinds the scratch allocator of the calling thread on exit.
+class MIRAGE_API ScratchScope {
+ public:
+  ScratchScope(const ScratchScope&) = delete;
+
+  ScratchScope();
+  ~ScratchScope() = default;
+
+  // Empty array allocating from the scratch allocator, it must be destructed
+  // before this scope.
+  template <std::move_constructible T>
+  [[nodiscard]] Array<T> NewArray(size_t capacity = 0) const;
+
+ private:
+  ArenaScope scope_;
+};
+
+template <std::move_constructible T>
+Array<T> ScratchScope::NewArray(const size_t capacity) const {
+  Array<T> array(ScratchAllocator::Get());
+  array.SetCapacity(capacity);
+  return array;
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_MEMORY_SCRATCH_ALLOCATOR
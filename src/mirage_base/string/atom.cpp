@@ -0,0 +1,107 @@
+#include "mirage_base/string/atom.hpp"
+
+#include <cstring>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/memory/arena.hpp"
+#include "mirage_base/synchronize/lock.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+// Open addressing with linear probing, kept at most three quarters full.
+class AtomTable {
+ public:
+  AtomTable() { Rehash(64); }
+
+  const String* Intern(const char* str, const size_t size) {
+    const size_t hash = HashBytes(str, size);
+    LockGuard guard(lock_);
+    size_t index = Find(str, size, hash);
+    if (slots_[index] != nullptr) {
+      return slots_[index];
+    }
+    if ((cnt_ + 1) * 4 > slots_.GetSize() * 3) {
+      Rehash(2 * slots_.GetSize());
+      index = Find(str, size, hash);
+    }
+    const String* entry = arena_.New<String>(str, size);
+    static_cast<void>(entry->GetHash());  // Atoms never hash again.
+    slots_[index] = entry;
+    ++cnt_;
+    return entry;
+  }
+
+  size_t GetCnt() {
+    LockGuard guard(lock_);
+    return cnt_;
+  }
+
+ private:
+  // Slot holding the string, or the empty slot where it belongs.
+  [[nodiscard]] size_t Find(const char* str, const size_t size,
+                            const size_t hash) const {
+    const size_t mask = slots_.GetSize() - 1;
+    size_t index = hash & mask;
+    while (slots_[index] != nullptr) {
+      const String* entry = slots_[index];
+      if (entry->GetHash() == hash && entry->GetSize() == size &&
+          std::memcmp(entry->GetCStr(), str, size) == 0) {
+        break;
+      }
+      index = (index + 1) & mask;
+    }
+    return index;
+  }
+
+  void Rehash(const size_t slot_cnt) {
+    Array<const String*> slots;
+    slots.SetCapacity(slot_cnt);
+    for (size_t i = 0; i < slot_cnt; ++i) {
+      slots.Push(nullptr);
+    }
+    const Array<const String*> old_slots = std::move(slots_);
+    slots_ = std::move(slots);
+    for (const String* entry : old_slots) {
+      if (entry != nullptr) {
+        slots_[Find(entry->GetCStr(), entry->GetSize(), entry->GetHash())] =
+            entry;
+      }
+    }
+  }
+
+  Lock lock_{"AtomTable"};
+  Arena arena_;
+  Array<const String*> slots_;
+  size_t cnt_{0};
+};
+
+AtomTable& GetTable() {
+  // Never destructed, atoms may be used during exit.
+  static auto* table = new AtomTable();
+  return *table;
+}
+
+const String* Intern(const char* str, const size_t size) {
+  static const String empty;
+  return size == 0 ? &empty : GetTable().Intern(str, size);
+}
+
+}  // namespace
+
+Atom::Atom() : Atom(nullptr, 0) {}
+
+Atom::Atom(const char* str) : Atom(str, std::strlen(str)) {}
+
+Atom::Atom(const char* str, const size_t size) : str_(Intern(str, size)) {}
+
+Atom::Atom(const String& str) : Atom(str.GetCStr(), str.GetSize()) {}
+
+const String& Atom::GetString() const { return *str_; }
+
+const char* Atom::GetCStr() const { return str_->GetCStr(); }
+
+size_t Atom::GetHash() const { return str_->GetHash(); }
+
+size_t Atom::GetInternedCnt() { return GetTable().GetCnt(); }
@@ -0,0 +1,48 @@
+#ifndef MIRAGE_BASE_STRING_ATOM
+#define MIRAGE_BASE_STRING_ATOM
+
+#include <cstddef>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/string/string.hpp"
+#include "mirage_base/util/hash.hpp"
+
+namespace mirage::base {
+
+// Interned string, a single pointer into a process wide table. Atoms of equal
+// strings share one entry, so comparing two atoms compares pointers and the
+// hash is the one cached by the entry. Interning takes a lock, convert
+// identifiers once and keep the atom. Entries live until the process exits.
+class MIRAGE_API Atom {
+ public:
+  // The empty string.
+  Atom();
+  explicit Atom(const char* str);
+  Atom(const char* str, size_t size);
+  explicit Atom(const String& str);
+  ~Atom() = default;
+
+  Atom(const Atom& other) = default;
+  Atom& operator=(const Atom& other) = default;
+
+  bool operator==(const Atom& other) const = default;
+
+  [[nodiscard]] const String& GetString() const;
+  [[nodiscard]] const char* GetCStr() const;
+  [[nodiscard]] size_t GetHash() const;
+
+  // Number of distinct strings interned so far.
+  static size_t GetInternedCnt();
+
+ private:
+  const String* str_;
+};
+
+template <>
+struct Hash<Atom> {
+  size_t operator()(const Atom& atom) const { return atom.GetHash(); }
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_STRING_ATOM
@@ -0,0 +1,151 @@
+#include "mirage_base/string/string.hpp"
+
+#include <bit>
+#include <cstring>
+
+#include "mirage_base/memory/allocator.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+char* AllocateChars(const size_t capacity) {
+  return static_cast<char*>(
+      HeapAllocator::Get(MemoryTag::kString).Allocate(capacity, 1));
+}
+
+void DeallocateChars(char* chars, const size_t capacity) {
+  HeapAllocator::Get(MemoryTag::kString).Deallocate(chars, capacity, 1);
+}
+
+}  // namespace
+
+String::String() : inline_() {}
+
+String::String(const char* str) : String(str, std::strlen(str)) {}
+
+String::String(const char* str, const size_t size) : inline_() {
+  Assign(str, size);
+}
+
+String::~String() { FreeHeap(); }
+
+String::String(const String& other) : inline_() {
+  Assign(other.GetCStr(), other.size_);
+  hash_.store(other.hash_.load(std::memory_order_relaxed),
+              std::memory_order_relaxed);
+}
+
+String& String::operator=(const String& other) {
+  if (this != &other) {
+    this->~String();
+    new (this) String(other);
+  }
+  return *this;
+}
+
+String::String(String&& other) noexcept
+    : size_(other.size_),
+      hash_(other.hash_.load(std::memory_order_relaxed)) {
+  // Copies the heap pointer or the inline bytes alike.
+  std::memcpy(inline_, other.inline_, sizeof(inline_));
+  other.size_ = 0;
+  other.inline_[0] = '\0';
+  other.hash_.store(0, std::memory_order_relaxed);
+}
+
+String& String::operator=(String&& other) noexcept {
+  if (this != &other) {
+    this->~String();
+    new (this) String(std::move(other));
+  }
+  return *this;
+}
+
+bool String::operator==(const String& other) const {
+  if (size_ != other.size_) {
+    return false;
+  }
+  const size_t hash = hash_.load(std::memory_order_relaxed);
+  const size_t other_hash = other.hash_.load(std::memory_order_relaxed);
+  if (hash != 0 && other_hash != 0 && hash != other_hash) {
+    return false;
+  }
+  return std::memcmp(GetCStr(), other.GetCStr(), size_) == 0;
+}
+
+const char& String::operator[](const size_t index) const {
+  MIRAGE_DCHECK(index < size_);
+  return GetCStr()[index];
+}
+
+void String::Append(const char* str, const size_t size) {
+  const size_t new_size = size_ + size;
+  const bool is_fit = new_size <= kInlineCapacity ||
+                      (!IsInline() && new_size < GetHeapCapacity(size_));
+  if (is_fit) {
+    std::memcpy(GetData() + size_, str, size);
+  } else {
+    // `str` may point into this string, so copy before freeing.
+    char* chars = AllocateChars(GetHeapCapacity(new_size));
+    std::memcpy(chars, GetCStr(), size_);
+    std::memcpy(chars + size_, str, size);
+    FreeHeap();
+    heap_ = chars;
+  }
+  size_ = new_size;
+  GetData()[size_] = '\0';
+  hash_.store(0, std::memory_order_relaxed);
+}
+
+void String::Append(const String& other) {
+  Append(other.GetCStr(), other.size_);
+}
+
+void String::Clear() {
+  FreeHeap();
+  size_ = 0;
+  inline_[0] = '\0';
+  hash_.store(0, std::memory_order_relaxed);
+}
+
+const char* String::GetCStr() const { return IsInline() ? inline_ : heap_; }
+
+size_t String::GetSize() const { return size_; }
+
+bool String::IsEmpty() const { return size_ == 0; }
+
+bool String::IsInline() const { return size_ <= kInlineCapacity; }
+
+Span<const char> String::AsSpan() const { return {GetCStr(), size_}; }
+
+size_t String::GetHash() const {
+  size_t hash = hash_.load(std::memory_order_relaxed);
+  if (hash == 0) {
+    // Racing threads compute the same value.
+    hash = HashBytes(GetCStr(), size_);
+    hash_.store(hash, std::memory_order_relaxed);
+  }
+  return hash;
+}
+
+char* String::GetData() { return IsInline() ? inline_ : heap_; }
+
+void String::Assign(const char* str, const size_t size) {
+  if (size > kInlineCapacity) {
+    heap_ = AllocateChars(GetHeapCapacity(size));
+  }
+  size_ = size;
+  std::memcpy(GetData(), str, size);
+  GetData()[size] = '\0';
+}
+
+void String::FreeHeap() {
+  if (!IsInline()) {
+    DeallocateChars(heap_, GetHeapCapacity(size_));
+  }
+}
+
+size_t String::GetHeapCapacity(const size_t size) {
+  return std::bit_ceil(size + 1);
+}
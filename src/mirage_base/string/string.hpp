@@ -0,0 +1,72 @@
+#ifndef MIRAGE_BASE_STRING_STRING
+#define MIRAGE_BASE_STRING_STRING
+
+#include <atomic>
+#include <cstddef>
+
+#include "mirage_base/container/span.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/util/hash.hpp"
+
+namespace mirage::base {
+
+// Null terminated byte string. Strings of up to `kInlineCapacity` bytes are
+// stored inline without touching the heap. The hash is computed on first use
+// and kept until the string changes, so repeated lookups with the same key
+// only hash it once.
+class MIRAGE_API String {
+ public:
+  static constexpr size_t kInlineCapacity = 22;
+
+  String();
+  // NOLINTNEXTLINE: Convert from literal
+  String(const char* str);
+  String(const char* str, size_t size);
+  ~String();
+
+  String(const String& other);
+  String& operator=(const String& other);
+  String(String&& other) noexcept;
+  String& operator=(String&& other) noexcept;
+
+  bool operator==(const String& other) const;
+
+  const char& operator[](size_t index) const;
+
+  void Append(const char* str, size_t size);
+  void Append(const String& other);
+  void Clear();
+
+  [[nodiscard]] const char* GetCStr() const;
+  [[nodiscard]] size_t GetSize() const;
+  [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] bool IsInline() const;
+  [[nodiscard]] Span<const char> AsSpan() const;
+  [[nodiscard]] size_t GetHash() const;
+
+ private:
+  char* GetData();
+  void Assign(const char* str, size_t size);
+  void FreeHeap();
+
+  // Heap buffers hold `std::bit_ceil(size + 1)` bytes, so the capacity does
+  // not have to be stored.
+  static size_t GetHeapCapacity(size_t size);
+
+  union {
+    char* heap_;
+    char inline_[kInlineCapacity + 1];
+  };
+  size_t size_{0};
+  // Zero until computed.
+  mutable std::atomic<size_t> hash_{0};
+};
+
+template <>
+struct Hash<String> {
+  size_t operator()(const String& str) const { return str.GetHash(); }
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_STRING_STRING
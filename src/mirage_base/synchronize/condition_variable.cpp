@@ -0,0 +1,34 @@
+#include "mirage_base/synchronize/condition_variable.hpp"
+
+#include "mirage_base/synchronize/futex.hpp"
+
+using namespace mirage::base;
+
+void ConditionVariable::Wait(Lock& lock) {
+  // Read under the lock, so a notification after it changes the word and the
+  // futex does not sleep through it.
+  const uint32_t seq = seq_.load(std::memory_order_relaxed);
+  lock.Release();
+  Futex::Wait(seq_, seq);
+  lock.Acquire();
+}
+
+bool ConditionVariable::WaitFor(Lock& lock,
+                                const std::chrono::nanoseconds timeout) {
+  const uint32_t seq = seq_.load(std::memory_order_relaxed);
+  lock.Release();
+  const bool is_woken =
+      Futex::WaitUntil(seq_, seq, Futex::Clock::now() + timeout);
+  lock.Acquire();
+  return is_woken;
+}
+
+void ConditionVariable::NotifyOne() {
+  seq_.fetch_add(1, std::memory_order_relaxed);
+  Futex::WakeOne(seq_);
+}
+
+void ConditionVariable::NotifyAll() {
+  seq_.fetch_add(1, std::memory_order_relaxed);
+  Futex::WakeAll(seq_);
+}
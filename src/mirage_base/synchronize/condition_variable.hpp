@@ -0,0 +1,37 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_CONDITION_VARIABLE
+#define MIRAGE_BASE_SYNCHRONIZE_CONDITION_VARIABLE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/synchronize/lock.hpp"
+
+namespace mirage::base {
+
+// Waits for a condition guarded by a `Lock`. Waits may return spuriously,
+// check the condition in a loop. Notifying does not require the lock, but
+// the condition must be changed under it, otherwise a waiter may miss it.
+class MIRAGE_API ConditionVariable {
+ public:
+  ConditionVariable() = default;
+  ConditionVariable(const ConditionVariable&) = delete;
+  ~ConditionVariable() = default;
+
+  // `lock` must be held, it is released while waiting.
+  void Wait(Lock& lock);
+  // Returns false on timeout.
+  bool WaitFor(Lock& lock, std::chrono::nanoseconds timeout);
+
+  void NotifyOne();
+  void NotifyAll();
+
+ private:
+  // Bumped by every notification.
+  std::atomic<uint32_t> seq_{0};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_CONDITION_VARIABLE
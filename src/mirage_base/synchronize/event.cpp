@@ -0,0 +1,73 @@
+#include "mirage_base/synchronize/event.hpp"
+
+#include "mirage_base/synchronize/futex.hpp"
+
+using namespace mirage::base;
+
+ManualResetEvent::ManualResetEvent(const bool is_set) : is_set_(is_set) {}
+
+void ManualResetEvent::Set() {
+  if (is_set_.exchange(1, std::memory_order_release) == 0) {
+    Futex::WakeAll(is_set_);
+  }
+}
+
+void ManualResetEvent::Reset() { is_set_.store(0, std::memory_order_relaxed); }
+
+bool ManualResetEvent::IsSet() const {
+  return is_set_.load(std::memory_order_acquire) != 0;
+}
+
+void ManualResetEvent::Wait() {
+  while (!IsSet()) {
+    Futex::Wait(is_set_, 0);
+  }
+}
+
+bool ManualResetEvent::WaitFor(const std::chrono::nanoseconds timeout) {
+  const Futex::Clock::time_point deadline = Futex::Clock::now() + timeout;
+  while (!IsSet()) {
+    if (!Futex::WaitUntil(is_set_, 0, deadline)) {
+      return IsSet();
+    }
+  }
+  return true;
+}
+
+AutoResetEvent::AutoResetEvent(const bool is_set) : is_set_(is_set) {}
+
+void AutoResetEvent::Set() {
+  // Pairs with the waiters, which announce themselves before parking.
+  if (is_set_.exchange(1, std::memory_order_seq_cst) == 0 &&
+      waiter_cnt_.load(std::memory_order_seq_cst) != 0) {
+    Futex::WakeOne(is_set_);
+  }
+}
+
+bool AutoResetEvent::TryWait() {
+  uint32_t expected = 1;
+  return is_set_.compare_exchange_strong(expected, 0,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed);
+}
+
+void AutoResetEvent::Wait() {
+  while (!TryWait()) {
+    waiter_cnt_.fetch_add(1, std::memory_order_seq_cst);
+    Futex::Wait(is_set_, 0);
+    waiter_cnt_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+bool AutoResetEvent::WaitFor(const std::chrono::nanoseconds timeout) {
+  const Futex::Clock::time_point deadline = Futex::Clock::now() + timeout;
+  while (!TryWait()) {
+    waiter_cnt_.fetch_add(1, std::memory_order_seq_cst);
+    const bool is_woken = Futex::WaitUntil(is_set_, 0, deadline);
+    waiter_cnt_.fetch_sub(1, std::memory_order_relaxed);
+    if (!is_woken) {
+      return TryWait();
+    }
+  }
+  return true;
+}
@@ -0,0 +1,53 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_EVENT
+#define MIRAGE_BASE_SYNCHRONIZE_EVENT
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Stays set until reset, releasing every waiter meanwhile.
+class MIRAGE_API ManualResetEvent {
+ public:
+  explicit ManualResetEvent(bool is_set = false);
+  ManualResetEvent(const ManualResetEvent&) = delete;
+  ~ManualResetEvent() = default;
+
+  void Set();
+  void Reset();
+  [[nodiscard]] bool IsSet() const;
+
+  void Wait();
+  // Returns false on timeout.
+  bool WaitFor(std::chrono::nanoseconds timeout);
+
+ private:
+  std::atomic<uint32_t> is_set_;
+};
+
+// Releases a single waiter per `Set`, resetting itself as the waiter passes.
+// Sets while already set are lost.
+class MIRAGE_API AutoResetEvent {
+ public:
+  explicit AutoResetEvent(bool is_set = false);
+  AutoResetEvent(const AutoResetEvent&) = delete;
+  ~AutoResetEvent() = default;
+
+  void Set();
+
+  [[nodiscard]] bool TryWait();
+  void Wait();
+  // Returns false on timeout.
+  bool WaitFor(std::chrono::nanoseconds timeout);
+
+ private:
+  std::atomic<uint32_t> is_set_;
+  std::atomic<uint32_t> waiter_cnt_{0};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_EVENT
@@ -0,0 +1,32 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_FUTEX
+#define MIRAGE_BASE_SYNCHRONIZE_FUTEX
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Parks threads on a 32-bit word until another thread changes the word and
+// wakes them. Building block for the blocking primitives in this directory.
+class MIRAGE_API Futex {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  Futex() = delete;
+
+  // Returns at once if `word` does not hold `expected`, and may return
+  // spuriously, so callers re-check their condition in a loop.
+  static void Wait(std::atomic<uint32_t>& word, uint32_t expected);
+  // Like `Wait`, returns false once `deadline` has passed.
+  static bool WaitUntil(std::atomic<uint32_t>& word, uint32_t expected,
+                        Clock::time_point deadline);
+  static void WakeOne(std::atomic<uint32_t>& word);
+  static void WakeAll(std::atomic<uint32_t>& word);
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_FUTEX
@@ -0,0 +1,33 @@
+#ifdef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/synchronize/futex.hpp"
+
+#include <windows.h>
+
+using namespace mirage::base;
+
+void Futex::Wait(std::atomic<uint32_t>& word, uint32_t expected) {
+  WaitOnAddress(&word, &expected, sizeof(expected), INFINITE);
+}
+
+bool Futex::WaitUntil(std::atomic<uint32_t>& word, uint32_t expected,
+                      const Clock::time_point deadline) {
+  const auto timeout = std::chrono::ceil<std::chrono::milliseconds>(
+      deadline - Clock::now());
+  if (timeout.count() <= 0) {
+    return false;
+  }
+  const DWORD ms = timeout.count() < INFINITE
+                       ? static_cast<DWORD>(timeout.count())
+                       : INFINITE - 1;
+  return WaitOnAddress(&word, &expected, sizeof(expected), ms) ||
+         GetLastError() != ERROR_TIMEOUT;
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& word) {
+  WakeByAddressSingle(&word);
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& word) { WakeByAddressAll(&word); }
+
+#endif
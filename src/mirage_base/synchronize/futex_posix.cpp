@@ -0,0 +1,81 @@
+#ifndef MIRAGE_BUILD_MSVC
+
+#include "mirage_base/synchronize/futex.hpp"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#else
+#include <thread>
+#endif
+
+using namespace mirage::base;
+
+#if defined(__linux__)
+
+namespace {
+
+long Call(std::atomic<uint32_t>& word, const int op, const uint32_t val,
+          const timespec* timeout = nullptr) {
+  return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op, val,
+                 timeout, nullptr, 0);
+}
+
+}  // namespace
+
+void Futex::Wait(std::atomic<uint32_t>& word, const uint32_t expected) {
+  Call(word, FUTEX_WAIT_PRIVATE, expected);
+}
+
+bool Futex::WaitUntil(std::atomic<uint32_t>& word, const uint32_t expected,
+                      const Clock::time_point deadline) {
+  const auto timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      deadline - Clock::now());
+  if (timeout.count() <= 0) {
+    return false;
+  }
+  const timespec spec{
+      .tv_sec = static_cast<time_t>(timeout.count() / 1000000000),
+      .tv_nsec = static_cast<long>(timeout.count() % 1000000000)};
+  return Call(word, FUTEX_WAIT_PRIVATE, expected, &spec) == 0 ||
+         errno != ETIMEDOUT;
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& word) {
+  Call(word, FUTEX_WAKE_PRIVATE, 1);
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& word) {
+  Call(word, FUTEX_WAKE_PRIVATE, INT_MAX);
+}
+
+#else
+
+void Futex::Wait(std::atomic<uint32_t>& word, const uint32_t expected) {
+  word.wait(expected);
+}
+
+bool Futex::WaitUntil(std::atomic<uint32_t>& word, const uint32_t expected,
+                      const Clock::time_point deadline) {
+  // `std::atomic` has no timed wait, poll instead.
+  while (word.load(std::memory_order_relaxed) == expected) {
+    if (Clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  return true;
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& word) { word.notify_one(); }
+
+void Futex::WakeAll(std::atomic<uint32_t>& word) { word.notify_all(); }
+
+#endif
+
+#endif
@@ -2,6 +2,44 @@
 
 using namespace mirage::base;
 
+#if defined(MIRAGE_LOCK_PROFILING)
+
+Lock::Lock(const std::source_location location)
+    : entry_(LockProfiler::Register(location.file_name(), location.line())) {}
+
+Lock::Lock(const char* name) : entry_(LockProfiler::Register(name, 0)) {}
+
+bool Lock::TryAcquire() const {
+  if (!lock_.TryAcquire()) {
+    return false;
+  }
+  LockProfiler::OnAcquire(entry_, 0, false);
+  acquire_time_ns_ = LockProfiler::GetTimeNs();
+  return true;
+}
+
+void Lock::Acquire() const {
+  if (lock_.TryAcquire()) {
+    LockProfiler::OnAcquire(entry_, 0, false);
+  } else {
+    const uint64_t begin_ns = LockProfiler::GetTimeNs();
+    lock_.Acquire();
+    LockProfiler::OnAcquire(entry_, LockProfiler::GetTimeNs() - begin_ns,
+                            true);
+  }
+  acquire_time_ns_ = LockProfiler::GetTimeNs();
+}
+
+void Lock::Release() const {
+  LockProfiler::OnRelease(entry_,
+                          LockProfiler::GetTimeNs() - acquire_time_ns_);
+  lock_.Release();
+}
+
+#else
+
+Lock::Lock(const char* /*name*/) {}
+
 bool Lock::TryAcquire() const {
   return lock_.TryAcquire();
 }
@@ -14,6 +52,8 @@ void Lock::Release() const {
   lock_.Release();
 }
 
+#endif
+
 LockGuard::LockGuard(Lock& lock) : lock_(lock) {
   lock.Acquire();
 }
@@ -4,11 +4,27 @@
 #include "mirage_base/define.hpp"
 #include "mirage_base/synchronize/lock_impl.hpp"
 
+#if defined(MIRAGE_LOCK_PROFILING)
+#include <cstdint>
+#include <source_location>
+
+#include "mirage_base/synchronize/lock_profiler.hpp"
+#endif
+
 namespace mirage::base {
 
 class MIRAGE_API Lock {
  public:
+#if defined(MIRAGE_LOCK_PROFILING)
+  // Unnamed locks are profiled by the place they are constructed at.
+  explicit Lock(
+      std::source_location location = std::source_location::current());
+#else
   Lock() = default;
+#endif
+  // Locks sharing a name share their profile, `name` must outlive the
+  // process, e.g. a literal. The name is ignored unless profiling.
+  explicit Lock(const char* name);
   ~Lock() = default;
 
   [[nodiscard]] bool TryAcquire() const;
@@ -17,6 +33,11 @@ class MIRAGE_API Lock {
 
  private:
   LockImpl lock_;
+#if defined(MIRAGE_LOCK_PROFILING)
+  LockProfiler::Entry* entry_;
+  // Only touched by the holder.
+  mutable uint64_t acquire_time_ns_{0};
+#endif
 };
 
 class MIRAGE_API LockGuard {
@@ -1,13 +1,25 @@
 #ifndef MIRAGE_BASE_SYNCHRONIZE_LOCK_IMPL
 #define MIRAGE_BASE_SYNCHRONIZE_LOCK_IMPL
 
+#include <atomic>
+#include <cstdint>
+
 #include "mirage_base/define.hpp"
 
+#if defined(__linux__)
+#define MIRAGE_LOCK_FUTEX
+#endif
+
 namespace mirage::base {
 
 class MIRAGE_API LockImpl {
  public:
+#if defined(MIRAGE_LOCK_FUTEX)
+  // 0 when free, 1 when held, 2 when held and threads may be parked on it.
+  using NativeHandle = std::atomic<uint32_t>;
+#else
   using NativeHandle = void*;
+#endif
 
   LockImpl();
   LockImpl(const LockImpl&) = delete;
@@ -20,7 +32,11 @@ class MIRAGE_API LockImpl {
  private:
   void AcquireInternal() const;
 
+#if defined(MIRAGE_LOCK_FUTEX)
+  mutable NativeHandle native_handle_{0};
+#else
   NativeHandle native_handle_;
+#endif
 };
 
 }  // namespace mirage::base
@@ -2,7 +2,11 @@
 
 #include "mirage_base/synchronize/lock_impl.hpp"
 
+#if defined(MIRAGE_LOCK_FUTEX)
+#include "mirage_base/synchronize/futex.hpp"
+#else
 #include <pthread.h>
+#endif
 
 using namespace mirage::base;
 
@@ -16,6 +20,69 @@ void LockImpl::Acquire() const {
   AcquireInternal();
 }
 
+#if defined(MIRAGE_LOCK_FUTEX)
+
+namespace {
+
+constexpr uint32_t kFree = 0;
+constexpr uint32_t kHeld = 1;
+constexpr uint32_t kContended = 2;
+
+// Pause iterations of the last spin round, a few hundred nanoseconds in total.
+constexpr uint32_t kMaxSpinCnt = 64;
+
+void Pause() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+}  // namespace
+
+LockImpl::LockImpl() = default;
+
+LockImpl::~LockImpl() = default;
+
+bool LockImpl::TryAcquire() const {
+  uint32_t expected = kFree;
+  return native_handle_.compare_exchange_strong(
+      expected, kHeld, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void LockImpl::AcquireInternal() const {
+  // Critical sections are usually short, so spin for a while with growing
+  // pauses before paying for a syscall. Stop early once others are parked.
+  for (uint32_t spin_cnt = 1; spin_cnt <= kMaxSpinCnt; spin_cnt *= 2) {
+    for (uint32_t i = 0; i < spin_cnt; ++i) {
+      Pause();
+    }
+    const uint32_t state = native_handle_.load(std::memory_order_relaxed);
+    if (state == kFree && TryAcquire()) {
+      return;
+    }
+    if (state == kContended) {
+      break;
+    }
+  }
+  // Whoever swaps in `kContended` over `kFree` owns the lock, and wakes a
+  // waiter on release since it can not tell whether others are still parked.
+  while (native_handle_.exchange(kContended, std::memory_order_acquire) !=
+         kFree) {
+    Futex::Wait(native_handle_, kContended);
+  }
+}
+
+void LockImpl::Release() const {
+  if (native_handle_.exchange(kFree, std::memory_order_release) ==
+      kContended) {
+    Futex::WakeOne(native_handle_);
+  }
+}
+
+#else
+
 LockImpl::LockImpl() {
   auto* handle = new pthread_mutex_t();
   pthread_mutex_init(handle, nullptr);
@@ -43,3 +110,5 @@ void LockImpl::Release() const {
 }
 
 #endif
+
+#endif
@@ -0,0 +1,130 @@
+#include "mirage_base/synchronize/lock_profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "mirage_base/util/cache_line_padded.hpp"
+#include "mirage_base/util/sort.hpp"
+
+using namespace mirage::base;
+
+struct alignas(kCacheLineSize) LockProfiler::Entry {
+  const char* name;
+  uint32_t line;
+  Entry* next{nullptr};
+  std::atomic<uint64_t> acquire_cnt{0};
+  std::atomic<uint64_t> contended_cnt{0};
+  std::atomic<uint64_t> total_wait_ns{0};
+  std::atomic<uint64_t> max_wait_ns{0};
+  std::atomic<uint64_t> total_hold_ns{0};
+  std::atomic<uint64_t> max_hold_ns{0};
+
+  Entry(const char* name, const uint32_t line) : name(name), line(line) {}
+};
+
+namespace {
+
+// Entries are only ever pushed and never freed, so readers walk the list
+// without synchronizing with writers beyond the head.
+std::atomic<LockProfiler::Entry*> g_head{nullptr};
+
+void UpdateMax(std::atomic<uint64_t>& max, const uint64_t val) {
+  uint64_t cur = max.load(std::memory_order_relaxed);
+  while (cur < val &&
+         !max.compare_exchange_weak(cur, val, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+LockProfiler::Entry* LockProfiler::Register(const char* name,
+                                            const uint32_t line) {
+  Entry* head = g_head.load(std::memory_order_acquire);
+  Entry* new_entry = nullptr;
+  while (true) {
+    for (Entry* entry = head; entry != nullptr; entry = entry->next) {
+      if (entry->line == line && std::strcmp(entry->name, name) == 0) {
+        delete new_entry;
+        return entry;
+      }
+    }
+    if (new_entry == nullptr) {
+      new_entry = new Entry(name, line);
+    }
+    new_entry->next = head;
+    if (g_head.compare_exchange_weak(head, new_entry,
+                                     std::memory_order_release,
+                                     std::memory_order_acquire)) {
+      return new_entry;
+    }
+  }
+}
+
+void LockProfiler::OnAcquire(Entry* entry, const uint64_t wait_ns,
+                             const bool is_contended) {
+  entry->acquire_cnt.fetch_add(1, std::memory_order_relaxed);
+  if (is_contended) {
+    entry->contended_cnt.fetch_add(1, std::memory_order_relaxed);
+    entry->total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    UpdateMax(entry->max_wait_ns, wait_ns);
+  }
+}
+
+void LockProfiler::OnRelease(Entry* entry, const uint64_t hold_ns) {
+  entry->total_hold_ns.fetch_add(hold_ns, std::memory_order_relaxed);
+  UpdateMax(entry->max_hold_ns, hold_ns);
+}
+
+uint64_t LockProfiler::GetTimeNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+Array<LockProfiler::Stats> LockProfiler::TakeSnapshot() {
+  Array<Stats> snapshot;
+  for (Entry* entry = g_head.load(std::memory_order_acquire);
+       entry != nullptr; entry = entry->next) {
+    Stats stats;
+    stats.name = entry->name;
+    stats.line = entry->line;
+    stats.acquire_cnt = entry->acquire_cnt.load(std::memory_order_relaxed);
+    stats.contended_cnt = entry->contended_cnt.load(std::memory_order_relaxed);
+    stats.total_wait_ns = entry->total_wait_ns.load(std::memory_order_relaxed);
+    stats.max_wait_ns = entry->max_wait_ns.load(std::memory_order_relaxed);
+    stats.total_hold_ns = entry->total_hold_ns.load(std::memory_order_relaxed);
+    stats.max_hold_ns = entry->max_hold_ns.load(std::memory_order_relaxed);
+    snapshot.Push(stats);
+  }
+  return snapshot;
+}
+
+void LockProfiler::Report() {
+  Array<Stats> snapshot = TakeSnapshot();
+  Sort(snapshot, [](const Stats& a, const Stats& b) {
+    return a.total_wait_ns > b.total_wait_ns;
+  });
+  for (const Stats& stats : snapshot) {
+    if (stats.acquire_cnt == 0) {
+      continue;
+    }
+    std::fprintf(stderr,
+                 "[mirage] %s:%u: %llu acquired, %llu contended, wait "
+                 "%llu ns (max %llu), hold %llu ns (max %llu)\n",
+                 stats.name, stats.line,
+                 static_cast<unsigned long long>(stats.acquire_cnt),
+                 static_cast<unsigned long long>(stats.contended_cnt),
+                 static_cast<unsigned long long>(stats.total_wait_ns),
+                 static_cast<unsigned long long>(stats.max_wait_ns),
+                 static_cast<unsigned long long>(stats.total_hold_ns),
+                 static_cast<unsigned long long>(stats.max_hold_ns));
+  }
+}
+
+void LockProfiler::ReportAtExit() {
+  std::atexit([] { Report(); });
+}
@@ -0,0 +1,55 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_LOCK_PROFILER
+#define MIRAGE_BASE_SYNCHRONIZE_LOCK_PROFILER
+
+#include <cstdint>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Contention statistics of `Lock`, kept per name in a lock-free registry.
+// Only collected when built with `MIRAGE_LOCK_PROFILING`, otherwise locks
+// carry no entry, the hooks are never called and the registry stays empty.
+class MIRAGE_API LockProfiler {
+ public:
+  struct Entry;
+
+  struct Stats {
+    const char* name{nullptr};
+    // Line of the construction site for unnamed locks, zero for named ones.
+    uint32_t line{0};
+    uint64_t acquire_cnt{0};
+    // Acquisitions that found the lock held.
+    uint64_t contended_cnt{0};
+    uint64_t total_wait_ns{0};
+    uint64_t max_wait_ns{0};
+    uint64_t total_hold_ns{0};
+    uint64_t max_hold_ns{0};
+  };
+
+#if defined(MIRAGE_LOCK_PROFILING)
+  static constexpr bool kIsEnabled = true;
+#else
+  static constexpr bool kIsEnabled = false;
+#endif
+
+  LockProfiler() = delete;
+
+  // Finds or adds the entry of `name` and `line`. `name` must outlive the
+  // process, e.g. a literal or a file name from `std::source_location`.
+  static Entry* Register(const char* name, uint32_t line);
+  static void OnAcquire(Entry* entry, uint64_t wait_ns, bool is_contended);
+  static void OnRelease(Entry* entry, uint64_t hold_ns);
+  static uint64_t GetTimeNs();
+
+  static Array<Stats> TakeSnapshot();
+  // Prints every acquired lock to stderr, longest total wait first.
+  static void Report();
+  // Calls `Report` when the process exits normally.
+  static void ReportAtExit();
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_LOCK_PROFILER
@@ -0,0 +1,152 @@
+#include "mirage_base/synchronize/rw_lock.hpp"
+
+#include <atomic>
+
+#include "mirage_base/synchronize/futex.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+constexpr uint32_t kReaderMask = (1u << 15) - 1;
+constexpr uint32_t kParked = 1u << 15;
+constexpr uint32_t kWriterOne = 1u << 16;
+constexpr uint32_t kWriterMask = ((1u << 15) - 1) << 16;
+constexpr uint32_t kWriteLocked = 1u << 31;
+
+}  // namespace
+
+bool RWLock::TryAcquireShared() const {
+  uint32_t state = state_.load(std::memory_order_relaxed);
+  while ((state & kWriterMask) == 0) {
+    MIRAGE_DCHECK((state & kReaderMask) != kReaderMask);
+    if (state_.compare_exchange_weak(state, state + 1,
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void RWLock::AcquireShared() const {
+  while (!TryAcquireShared()) {
+    const uint32_t state = state_.load(std::memory_order_relaxed);
+    if ((state & kWriterMask) != 0) {
+      Park(state);
+    }
+  }
+}
+
+void RWLock::ReleaseShared() const {
+  const uint32_t state = state_.fetch_sub(1, std::memory_order_release) - 1;
+  // Only writers wait for readers, and only for the last one.
+  if ((state & kReaderMask) == 0) {
+    WakeParked(state);
+  }
+}
+
+bool RWLock::TryAcquireExclusive() const {
+  uint32_t expected = 0;
+  return state_.compare_exchange_strong(expected, kWriteLocked | kWriterOne,
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed);
+}
+
+void RWLock::AcquireExclusive() const {
+  if (TryAcquireExclusive()) {
+    return;
+  }
+  // Announce the writer first, which holds off new readers.
+  uint32_t state =
+      state_.fetch_add(kWriterOne, std::memory_order_relaxed) + kWriterOne;
+  while (true) {
+    if ((state & (kReaderMask | kWriteLocked)) == 0) {
+      if (state_.compare_exchange_weak(state, state | kWriteLocked,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        return;
+      }
+      continue;
+    }
+    Park(state);
+    state = state_.load(std::memory_order_relaxed);
+  }
+}
+
+void RWLock::ReleaseExclusive() const {
+  const uint32_t state = state_.fetch_sub(kWriteLocked | kWriterOne,
+                                          std::memory_order_release) -
+                         (kWriteLocked | kWriterOne);
+  WakeParked(state);
+}
+
+void RWLock::Park(uint32_t state) const {
+  if ((state & kParked) == 0) {
+    if (!state_.compare_exchange_strong(state, state | kParked,
+                                        std::memory_order_relaxed)) {
+      return;
+    }
+    state |= kParked;
+  }
+  Futex::Wait(state_, state);
+}
+
+void RWLock::WakeParked(const uint32_t state) const {
+  // Parked readers and writers share the word, wake all of them to re-check.
+  if ((state & kParked) != 0) {
+    state_.fetch_and(~kParked, std::memory_order_relaxed);
+    Futex::WakeAll(state_);
+  }
+}
+
+void BigReaderLock::AcquireShared() const {
+  std::atomic<uint32_t>& slot = *readers_[GetSlotIndex()];
+  while (true) {
+    // Pairs with the writer, which raises its flag before reading the slots.
+    // Sequential consistency makes at least one of the two see the other.
+    slot.fetch_add(1, std::memory_order_seq_cst);
+    if (writer_.load(std::memory_order_seq_cst) == 0) {
+      return;
+    }
+    ReleaseShared();
+    while (writer_.load(std::memory_order_acquire) != 0) {
+      Futex::Wait(writer_, 1);
+    }
+  }
+}
+
+void BigReaderLock::ReleaseShared() const {
+  std::atomic<uint32_t>& slot = *readers_[GetSlotIndex()];
+  if (slot.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+      writer_.load(std::memory_order_seq_cst) != 0) {
+    Futex::WakeAll(slot);
+  }
+}
+
+void BigReaderLock::AcquireExclusive() const {
+  writer_lock_.Acquire();
+  writer_.store(1, std::memory_order_seq_cst);
+  for (CacheLinePadded<std::atomic<uint32_t>>& slot : readers_) {
+    uint32_t cnt = slot->load(std::memory_order_seq_cst);
+    while (cnt != 0) {
+      Futex::Wait(*slot, cnt);
+      cnt = slot->load(std::memory_order_seq_cst);
+    }
+  }
+}
+
+void BigReaderLock::ReleaseExclusive() const {
+  writer_.store(0, std::memory_order_release);
+  Futex::WakeAll(writer_);
+  writer_lock_.Release();
+}
+
+size_t BigReaderLock::GetSlotIndex() {
+  // Round-robin rather than a hash of the thread id, which some standard
+  // libraries return unchanged as an aligned address.
+  static std::atomic<size_t> next_index{0};
+  thread_local const size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kSlotCnt;
+  return index;
+}
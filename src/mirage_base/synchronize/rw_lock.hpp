@@ -0,0 +1,99 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_RW_LOCK
+#define MIRAGE_BASE_SYNCHRONIZE_RW_LOCK
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+#include "mirage_base/synchronize/lock.hpp"
+#include "mirage_base/util/cache_line_padded.hpp"
+
+namespace mirage::base {
+
+// Lock held by many readers or a single writer. Writers are preferred: once
+// a writer waits, new readers queue behind it, so a steady stream of readers
+// can not starve writers.
+class MIRAGE_API RWLock {
+ public:
+  RWLock() = default;
+  RWLock(const RWLock&) = delete;
+  ~RWLock() = default;
+
+  [[nodiscard]] bool TryAcquireShared() const;
+  void AcquireShared() const;
+  void ReleaseShared() const;
+
+  [[nodiscard]] bool TryAcquireExclusive() const;
+  void AcquireExclusive() const;
+  void ReleaseExclusive() const;
+
+ private:
+  void Park(uint32_t state) const;
+  void WakeParked(uint32_t state) const;
+
+  // Readers in the low bits, then a flag for parked threads, then the count
+  // of writers holding or waiting for the lock, then the write lock flag.
+  mutable std::atomic<uint32_t> state_{0};
+};
+
+// Lock for data read far more often than written. Readers only touch a
+// counter on a cache line of its own instead of a shared word, so they scale
+// with the thread count, while a writer has to visit every counter.
+class MIRAGE_API BigReaderLock {
+ public:
+  static constexpr size_t kSlotCnt = 16;
+
+  BigReaderLock() = default;
+  BigReaderLock(const BigReaderLock&) = delete;
+  ~BigReaderLock() = default;
+
+  // Must be released on the acquiring thread.
+  void AcquireShared() const;
+  void ReleaseShared() const;
+
+  void AcquireExclusive() const;
+  void ReleaseExclusive() const;
+
+ private:
+  // Slot of the calling thread. Threads rather than CPUs pick the slot, since
+  // a reader may move to another CPU before it releases.
+  static size_t GetSlotIndex();
+
+  mutable CacheLinePadded<std::atomic<uint32_t>> readers_[kSlotCnt];
+  // Non-zero while a writer holds or waits for the lock.
+  mutable std::atomic<uint32_t> writer_{0};
+  Lock writer_lock_;
+};
+
+template <typename T>
+class SharedLockGuard {
+ public:
+  SharedLockGuard() = delete;
+  SharedLockGuard(const SharedLockGuard&) = delete;
+
+  explicit SharedLockGuard(T& lock) : lock_(lock) { lock.AcquireShared(); }
+  ~SharedLockGuard() { lock_.ReleaseShared(); }
+
+ private:
+  T& lock_;
+};
+
+template <typename T>
+class ExclusiveLockGuard {
+ public:
+  ExclusiveLockGuard() = delete;
+  ExclusiveLockGuard(const ExclusiveLockGuard&) = delete;
+
+  explicit ExclusiveLockGuard(T& lock) : lock_(lock) {
+    lock.AcquireExclusive();
+  }
+  ~ExclusiveLockGuard() { lock_.ReleaseExclusive(); }
+
+ private:
+  T& lock_;
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_RW_LOCK
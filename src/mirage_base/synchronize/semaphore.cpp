@@ -0,0 +1,57 @@
+#include "mirage_base/synchronize/semaphore.hpp"
+
+#include "mirage_base/synchronize/futex.hpp"
+
+using namespace mirage::base;
+
+Semaphore::Semaphore(const uint32_t cnt) : cnt_(cnt) {}
+
+bool Semaphore::TryAcquire() {
+  uint32_t cnt = cnt_.load(std::memory_order_relaxed);
+  while (cnt != 0) {
+    if (cnt_.compare_exchange_weak(cnt, cnt - 1, std::memory_order_acquire,
+                                   std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Semaphore::Acquire() {
+  while (!TryAcquire()) {
+    // Announce the waiter before checking the count a last time. Pairs with
+    // `Release`, which bumps the count before reading the waiters.
+    waiter_cnt_.fetch_add(1, std::memory_order_seq_cst);
+    Futex::Wait(cnt_, 0);
+    waiter_cnt_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+bool Semaphore::AcquireFor(const std::chrono::nanoseconds timeout) {
+  const Futex::Clock::time_point deadline = Futex::Clock::now() + timeout;
+  while (!TryAcquire()) {
+    waiter_cnt_.fetch_add(1, std::memory_order_seq_cst);
+    const bool is_woken = Futex::WaitUntil(cnt_, 0, deadline);
+    waiter_cnt_.fetch_sub(1, std::memory_order_relaxed);
+    if (!is_woken) {
+      return TryAcquire();
+    }
+  }
+  return true;
+}
+
+void Semaphore::Release(const uint32_t cnt) {
+  cnt_.fetch_add(cnt, std::memory_order_seq_cst);
+  if (waiter_cnt_.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+  if (cnt == 1) {
+    Futex::WakeOne(cnt_);
+  } else {
+    Futex::WakeAll(cnt_);
+  }
+}
+
+uint32_t Semaphore::GetCnt() const {
+  return cnt_.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,35 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_SEMAPHORE
+#define MIRAGE_BASE_SYNCHRONIZE_SEMAPHORE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Counting semaphore. Releasing only calls into the kernel when a thread is
+// parked.
+class MIRAGE_API Semaphore {
+ public:
+  explicit Semaphore(uint32_t cnt = 0);
+  Semaphore(const Semaphore&) = delete;
+  ~Semaphore() = default;
+
+  [[nodiscard]] bool TryAcquire();
+  void Acquire();
+  // Returns false on timeout.
+  bool AcquireFor(std::chrono::nanoseconds timeout);
+  void Release(uint32_t cnt = 1);
+
+  [[nodiscard]] uint32_t GetCnt() const;
+
+ private:
+  std::atomic<uint32_t> cnt_;
+  std::atomic<uint32_t> waiter_cnt_{0};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_SEMAPHORE
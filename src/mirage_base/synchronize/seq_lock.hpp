@@ -0,0 +1,132 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_SEQ_LOCK
+#define MIRAGE_BASE_SYNCHRONIZE_SEQ_LOCK
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#include "mirage_base/util/aligned_memory.hpp"
+
+namespace mirage::base {
+
+// Small value written rarely and read often. Readers never write shared
+// memory, they copy the value and retry if a writer ran meanwhile, so any
+// number of them scale without bouncing a cache line. Writers exclude each
+// other and never wait for readers.
+//
+// Ordering: the sequence is odd while a write is in flight. A writer makes it
+// odd and then stores the value with release stores, so a reader that
+// acquires any of the new words also sees the odd sequence or a later one on
+// its re-check, and retries. The writer ends with a release store of the next
+// even sequence, so a reader that acquires that sequence first sees the whole
+// value. `Load` thus returns a value some `Store` wrote as a whole, and
+// synchronizes with that `Store`, like an acquire load of an atomic `T`.
+//
+// The value is kept in atomic words rather than plain memory, so the racy
+// copy of a reader that is retried afterwards is not a data race. No fences
+// are needed, and on x86 the acquire loads and release stores are plain moves.
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class SeqLock {
+ public:
+  SeqLock()
+    requires std::default_initializable<T>
+      : SeqLock(T()) {}
+  SeqLock(const SeqLock&) = delete;
+  ~SeqLock() = default;
+
+  explicit SeqLock(const T& val) { StoreWords(val); }
+
+  [[nodiscard]] T Load() const {
+    AlignedMemory<T> val;
+    while (!TryLoadWords(val.GetPtr())) {
+      std::this_thread::yield();
+    }
+    return val.GetConstRef();
+  }
+
+  // Fails instead of retrying if a write overlaps the read.
+  [[nodiscard]] bool TryLoad(T& val) const {
+    AlignedMemory<T> copy;
+    if (!TryLoadWords(copy.GetPtr())) {
+      return false;
+    }
+    val = copy.GetConstRef();
+    return true;
+  }
+
+  void Store(const T& val) {
+    const uint64_t seq = AcquireWrite();
+    StoreWords(val);
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  // Calls `fn(T&)` on the current value and stores the result, with other
+  // writers excluded in between.
+  template <typename F>
+  void Update(F&& fn) {
+    const uint64_t seq = AcquireWrite();
+    AlignedMemory<T> val;
+    LoadWords(val.GetPtr());
+    fn(val.GetRef());
+    StoreWords(val.GetConstRef());
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+ private:
+  static constexpr size_t kWordCnt =
+      (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  // Makes the sequence odd and returns the even value it had.
+  uint64_t AcquireWrite() {
+    uint64_t seq = seq_.load(std::memory_order_relaxed);
+    while (true) {
+      if (seq % 2 == 0 &&
+          seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+        break;
+      }
+      if (seq % 2 != 0) {
+        std::this_thread::yield();
+        seq = seq_.load(std::memory_order_relaxed);
+      }
+    }
+    return seq;
+  }
+
+  bool TryLoadWords(T* val) const {
+    const uint64_t seq = seq_.load(std::memory_order_acquire);
+    if (seq % 2 != 0) {
+      return false;
+    }
+    LoadWords(val);
+    return seq_.load(std::memory_order_relaxed) == seq;
+  }
+
+  void LoadWords(T* val) const {
+    uint64_t words[kWordCnt];
+    for (size_t i = 0; i < kWordCnt; ++i) {
+      words[i] = words_[i].load(std::memory_order_acquire);
+    }
+    std::memcpy(val, words, sizeof(T));
+  }
+
+  void StoreWords(const T& val) {
+    uint64_t words[kWordCnt]{};
+    std::memcpy(words, &val, sizeof(T));
+    for (size_t i = 0; i < kWordCnt; ++i) {
+      words_[i].store(words[i], std::memory_order_release);
+    }
+  }
+
+  std::atomic<uint64_t> seq_{0};
+  std::atomic<uint64_t> words_[kWordCnt];
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_SEQ_LOCK
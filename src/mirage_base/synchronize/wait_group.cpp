@@ -0,0 +1,43 @@
+#include "mirage_base/synchronize/wait_group.hpp"
+
+#include "mirage_base/synchronize/futex.hpp"
+
+using namespace mirage::base;
+
+void WaitGroup::Add(const uint32_t cnt) {
+  cnt_.fetch_add(cnt, std::memory_order_relaxed);
+}
+
+void WaitGroup::Done() {
+  const uint32_t cnt = cnt_.fetch_sub(1, std::memory_order_acq_rel);
+  MIRAGE_DCHECK(cnt != 0);
+  if (cnt == 1) {
+    Futex::WakeAll(cnt_);
+  }
+}
+
+void WaitGroup::Wait() {
+  // Waiters stay parked until the count drops to zero, earlier `Done` calls
+  // do not wake them.
+  uint32_t cnt = cnt_.load(std::memory_order_acquire);
+  while (cnt != 0) {
+    Futex::Wait(cnt_, cnt);
+    cnt = cnt_.load(std::memory_order_acquire);
+  }
+}
+
+bool WaitGroup::WaitFor(const std::chrono::nanoseconds timeout) {
+  const Futex::Clock::time_point deadline = Futex::Clock::now() + timeout;
+  uint32_t cnt = cnt_.load(std::memory_order_acquire);
+  while (cnt != 0) {
+    if (!Futex::WaitUntil(cnt_, cnt, deadline)) {
+      return cnt_.load(std::memory_order_acquire) == 0;
+    }
+    cnt = cnt_.load(std::memory_order_acquire);
+  }
+  return true;
+}
+
+uint32_t WaitGroup::GetCnt() const {
+  return cnt_.load(std::memory_order_relaxed);
+}
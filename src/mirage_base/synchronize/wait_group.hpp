@@ -0,0 +1,36 @@
+#ifndef MIRAGE_BASE_SYNCHRONIZE_WAIT_GROUP
+#define MIRAGE_BASE_SYNCHRONIZE_WAIT_GROUP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "mirage_base/define.hpp"
+
+namespace mirage::base {
+
+// Waits for a group of tasks to finish. Add the tasks before starting them,
+// each one calls `Done` when finished.
+class MIRAGE_API WaitGroup {
+ public:
+  WaitGroup() = default;
+  WaitGroup(const WaitGroup&) = delete;
+  ~WaitGroup() = default;
+
+  void Add(uint32_t cnt = 1);
+  void Done();
+
+  // Returns once every added task is done.
+  void Wait();
+  // Returns false on timeout.
+  bool WaitFor(std::chrono::nanoseconds timeout);
+
+  [[nodiscard]] uint32_t GetCnt() const;
+
+ private:
+  std::atomic<uint32_t> cnt_{0};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_SYNCHRONIZE_WAIT_GROUP
@@ -1,14 +1,19 @@
 #ifndef MIRAGE_BASE_UTIL_ALIGNED_MEMORY
 #define MIRAGE_BASE_UTIL_ALIGNED_MEMORY
 
+#include <bit>
 #include <cstddef>
 #include <utility>
 
 namespace mirage::base {
 
-template <typename T>
+// Uninitialized storage for a `T`. `ALIGN` may raise the alignment above
+// `alignof(T)`, which also rounds the size up to a multiple of `ALIGN`.
+template <typename T, size_t ALIGN = alignof(T)>
 class AlignedMemory {
  public:
+  static_assert(std::has_single_bit(ALIGN) && ALIGN >= alignof(T));
+
   AlignedMemory() = default;
   ~AlignedMemory() = default;
 
@@ -26,7 +31,7 @@ class AlignedMemory {
   const T& GetConstRef() const { return *GetConstPtr(); }
 
  private:
-  alignas(T) std::byte mem_[sizeof(T)]{};
+  alignas(ALIGN) std::byte mem_[sizeof(T)]{};
 };
 
 }  // namespace mirage::base
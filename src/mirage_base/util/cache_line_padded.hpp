@@ -0,0 +1,44 @@
+#ifndef MIRAGE_BASE_UTIL_CACHE_LINE_PADDED
+#define MIRAGE_BASE_UTIL_CACHE_LINE_PADDED
+
+#include <cstddef>
+#include <utility>
+
+namespace mirage::base {
+
+// Fixed instead of `std::hardware_destructive_interference_size`, which may
+// change with compiler flags and so must not leak into an ABI.
+constexpr size_t kCacheLineSize = 64;
+
+// Keeps a `T` on cache lines of its own, so that writes from different threads
+// to neighbouring elements, e.g. per thread counters, never share a line.
+template <typename T>
+class alignas(kCacheLineSize) CacheLinePadded {
+ public:
+  CacheLinePadded() = default;
+  ~CacheLinePadded() = default;
+
+  template <typename... Args>
+    requires(sizeof...(Args) > 0)
+  explicit CacheLinePadded(Args&&... args)
+      : val_(std::forward<Args>(args)...) {}
+
+  T* operator->() { return &val_; }
+
+  const T* operator->() const { return &val_; }
+
+  T& operator*() { return val_; }
+
+  const T& operator*() const { return val_; }
+
+  T& Get() { return val_; }
+
+  const T& Get() const { return val_; }
+
+ private:
+  T val_{};
+};
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_UTIL_CACHE_LINE_PADDED
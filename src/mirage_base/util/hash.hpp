@@ -3,6 +3,8 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace mirage::base {
 
@@ -22,6 +24,32 @@ struct Hash<size_t> {
   size_t operator()(const size_t val) const { return val; }
 };
 
+// Hashes a byte range eight bytes per step, with a final avalanche so that
+// the low bits are usable as a bucket index.
+inline size_t HashBytes(const void* data, const size_t size) {
+  constexpr uint64_t kMul = 0x9e3779b97f4a7c15;
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  uint64_t hash = size * kMul;
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, bytes + offset, sizeof(word));
+    hash = (hash ^ word) * kMul;
+    hash ^= hash >> 29;
+  }
+  if (offset < size) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes + offset, size - offset);
+    hash = (hash ^ word) * kMul;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccd;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53;
+  hash ^= hash >> 33;
+  return static_cast<size_t>(hash);
+}
+
 }  // namespace mirage::base
 
 #endif  // MIRAGE_BASE_UTIL_HASH
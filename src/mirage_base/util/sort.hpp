@@ -0,0 +1,741 @@
+#ifndef MIRAGE_BASE_UTIL_SORT
+#define MIRAGE_BASE_UTIL_SORT
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/define.hpp"
+#include "mirage_base/memory/allocator.hpp"
+
+namespace mirage::base {
+
+// Keys accepted by radix sort: integers and 32/64-bit floating points.
+template <typename K>
+concept RadixKeyType =
+    (std::integral<K> && !std::same_as<K, bool>) ||
+    (std::floating_point<K> && (sizeof(K) == 4 || sizeof(K) == 8));
+
+namespace sort_internal {
+
+constexpr ptrdiff_t kInsertionSortThreshold = 24;
+constexpr ptrdiff_t kNintherThreshold = 128;
+constexpr ptrdiff_t kPartialInsertionSortLimit = 8;
+constexpr ptrdiff_t kRadixSortThreshold = 512;
+constexpr size_t kBlockSize = 64;
+
+template <typename Less>
+constexpr bool kIsDefaultLess = std::same_as<Less, std::less<>>;
+
+// Arithmetic types with the default order can use branchless kernels, where
+// comparison is cheap and the result is used as data instead of a branch.
+template <typename T, typename Less>
+constexpr bool kIsBranchless = std::is_arithmetic_v<T> && kIsDefaultLess<Less>;
+
+template <typename T, typename Less>
+void InsertionSort(T* begin, T* end, Less& less) {
+  if (begin == end) {
+    return;
+  }
+  for (T* cur = begin + 1; cur != end; ++cur) {
+    T* sift = cur;
+    T* sift_1 = cur - 1;
+    if (less(*sift, *sift_1)) {
+      T tmp(std::move(*sift));
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && less(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Requires *(begin - 1) to be not greater than any element in range.
+template <typename T, typename Less>
+void UnguardedInsertionSort(T* begin, T* end, Less& less) {
+  if (begin == end) {
+    return;
+  }
+  for (T* cur = begin + 1; cur != end; ++cur) {
+    T* sift = cur;
+    T* sift_1 = cur - 1;
+    if (less(*sift, *sift_1)) {
+      T tmp(std::move(*sift));
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (less(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Gives up and returns false once too many elements have been moved.
+template <typename T, typename Less>
+bool PartialInsertionSort(T* begin, T* end, Less& less) {
+  if (begin == end) {
+    return true;
+  }
+  ptrdiff_t limit = 0;
+  for (T* cur = begin + 1; cur != end; ++cur) {
+    T* sift = cur;
+    T* sift_1 = cur - 1;
+    if (less(*sift, *sift_1)) {
+      T tmp(std::move(*sift));
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && less(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      limit += cur - sift;
+    }
+    if (limit > kPartialInsertionSortLimit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void CompareSwap(T& lhs, T& rhs) {
+  const T a = lhs;
+  const T b = rhs;
+  const bool swap = b < a;
+  lhs = swap ? b : a;
+  rhs = swap ? a : b;
+}
+
+// Comparator pairs of a sorting network.
+struct Network {
+  static constexpr size_t kMaxPairCnt = 192;
+
+  uint8_t lhs[kMaxPairCnt]{};
+  uint8_t rhs[kMaxPairCnt]{};
+  size_t cnt{0};
+};
+
+// Comparators of Batcher's odd-even merge network for `size` elements, built
+// at compile time. Elements past the end behave as +inf, so the comparators
+// touching them are dropped.
+consteval Network MakeNetwork(const ptrdiff_t size) {
+  Network network;
+  for (ptrdiff_t p = 1; p < size; p <<= 1) {
+    for (ptrdiff_t k = p; k >= 1; k >>= 1) {
+      for (ptrdiff_t j = k % p; j + k < size; j += 2 * k) {
+        for (ptrdiff_t i = 0; i < k && i + j + k < size; ++i) {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+            network.lhs[network.cnt] = static_cast<uint8_t>(i + j);
+            network.rhs[network.cnt] = static_cast<uint8_t>(i + j + k);
+            ++network.cnt;
+          }
+        }
+      }
+    }
+  }
+  return network;
+}
+
+// Fully unrolled network for exactly `SIZE` elements. Every comparator is a
+// min/max pair on fixed indices, which compiles to conditional moves instead
+// of branches and lets the elements stay in registers.
+template <typename T, ptrdiff_t SIZE>
+void NetworkSort(T* data) {
+  static constexpr Network kNetwork = MakeNetwork(SIZE);
+  static_assert(kNetwork.cnt <= Network::kMaxPairCnt);
+  [data]<size_t... Is>(std::index_sequence<Is...>) {
+    (CompareSwap(data[kNetwork.lhs[Is]], data[kNetwork.rhs[Is]]), ...);
+  }(std::make_index_sequence<kNetwork.cnt>());
+}
+
+// Sorts fewer than `kInsertionSortThreshold` elements.
+template <typename T>
+void NetworkSort(T* data, const ptrdiff_t size) {
+  using SortFn = void (*)(T*);
+  static constexpr std::array<SortFn, kInsertionSortThreshold> kSorts =
+      []<size_t... Ns>(std::index_sequence<Ns...>) {
+        return std::array<SortFn, sizeof...(Ns)>{
+            &NetworkSort<T, static_cast<ptrdiff_t>(Ns)>...};
+      }(std::make_index_sequence<kInsertionSortThreshold>());
+  MIRAGE_DCHECK(size < kInsertionSortThreshold);
+  kSorts[size](data);
+}
+
+template <typename T, typename Less>
+void Sort2(T* a, T* b, Less& less) {
+  if (less(*b, *a)) {
+    std::iter_swap(a, b);
+  }
+}
+
+template <typename T, typename Less>
+void Sort3(T* a, T* b, T* c, Less& less) {
+  Sort2(a, b, less);
+  Sort2(b, c, less);
+  Sort2(a, b, less);
+}
+
+template <typename T, typename Less>
+void ChoosePivot(T* begin, T* end, Less& less) {
+  const ptrdiff_t size = end - begin;
+  const ptrdiff_t half = size / 2;
+  if (size > kNintherThreshold) {
+    Sort3(begin, begin + half, end - 1, less);
+    Sort3(begin + 1, begin + (half - 1), end - 2, less);
+    Sort3(begin + 2, begin + (half + 1), end - 3, less);
+    Sort3(begin + (half - 1), begin + half, begin + (half + 1), less);
+    std::iter_swap(begin, begin + half);
+  } else {
+    Sort3(begin + half, begin, end - 1, less);
+  }
+}
+
+// Partitions [begin, end) around *begin. Elements equal to the pivot go to the
+// right. Returns the pivot position and whether the range was already
+// partitioned.
+template <typename T, typename Less>
+std::pair<T*, bool> PartitionRight(T* begin, T* end, Less& less) {
+  T pivot(std::move(*begin));
+  T* first = begin;
+  T* last = end;
+
+  while (less(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !less(*--last, pivot)) {
+    }
+  } else {
+    while (!less(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (less(*++first, pivot)) {
+    }
+    while (!less(*--last, pivot)) {
+    }
+  }
+
+  T* pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+template <typename T>
+void SwapOffsets(T* first, T* last, const uint8_t* offsets_l,
+                 const uint8_t* offsets_r, const size_t num,
+                 const bool use_swaps) {
+  if (use_swaps) {
+    // Keep proper swaps for descending inputs, otherwise the cyclic rotation
+    // below degrades them to O(n^2).
+    for (size_t i = 0; i < num; ++i) {
+      std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+    }
+  } else if (num > 0) {
+    T* l = first + offsets_l[0];
+    T* r = last - offsets_r[0];
+    T tmp(std::move(*l));
+    *l = std::move(*r);
+    for (size_t i = 1; i < num; ++i) {
+      l = first + offsets_l[i];
+      *r = std::move(*l);
+      r = last - offsets_r[i];
+      *l = std::move(*r);
+    }
+    *r = std::move(tmp);
+  }
+}
+
+// Same contract as PartitionRight. Follows BlockQuicksort: comparisons only
+// produce offsets of misplaced elements into small blocks, then the elements
+// are swapped block by block, so no branch depends on the comparison result.
+template <typename T, typename Less>
+std::pair<T*, bool> PartitionRightBranchless(T* begin, T* end, Less& less) {
+  T pivot(std::move(*begin));
+  T* first = begin;
+  T* last = end;
+
+  while (less(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !less(*--last, pivot)) {
+    }
+  } else {
+    while (!less(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  if (!already_partitioned) {
+    std::iter_swap(first, last);
+    ++first;
+
+    alignas(64) uint8_t offsets_l[kBlockSize];
+    alignas(64) uint8_t offsets_r[kBlockSize];
+    T* offsets_l_base = first;
+    T* offsets_r_base = last;
+    size_t num_l = 0;
+    size_t num_r = 0;
+    size_t start_l = 0;
+    size_t start_r = 0;
+
+    while (first < last) {
+      const auto num_unknown = static_cast<size_t>(last - first);
+      size_t left_split = 0;
+      if (num_l == 0) {
+        left_split = num_r == 0 ? num_unknown / 2 : num_unknown;
+      }
+      const size_t right_split = num_r == 0 ? num_unknown - left_split : 0;
+
+      const size_t left_cnt = left_split < kBlockSize ? left_split : kBlockSize;
+      for (size_t i = 0; i < left_cnt; ++i) {
+        offsets_l[num_l] = static_cast<uint8_t>(i);
+        num_l += !less(*first, pivot);
+        ++first;
+      }
+      const size_t right_cnt =
+          right_split < kBlockSize ? right_split : kBlockSize;
+      for (size_t i = 0; i < right_cnt; ++i) {
+        offsets_r[num_r] = static_cast<uint8_t>(i + 1);
+        num_r += less(*--last, pivot);
+      }
+
+      const size_t num = num_l < num_r ? num_l : num_r;
+      SwapOffsets(offsets_l_base, offsets_r_base, offsets_l + start_l,
+                  offsets_r + start_r, num, num_l == num_r);
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+
+      if (num_l == 0) {
+        start_l = 0;
+        offsets_l_base = first;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        offsets_r_base = last;
+      }
+    }
+
+    // Place the misplaced elements left in the unfinished block.
+    if (num_l != 0) {
+      while (num_l-- != 0) {
+        std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+      }
+      first = last;
+    }
+    if (num_r != 0) {
+      while (num_r-- != 0) {
+        std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+        ++first;
+      }
+      last = first;
+    }
+  }
+
+  T* pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// Partitions [begin, end) around *begin. Elements equal to the pivot go to the
+// left. Used when the pivot equals the element before the range, which means
+// the whole left part is equal and done.
+template <typename T, typename Less>
+T* PartitionLeft(T* begin, T* end, Less& less) {
+  T pivot(std::move(*begin));
+  T* first = begin;
+  T* last = end;
+
+  while (less(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !less(pivot, *++first)) {
+    }
+  } else {
+    while (!less(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (less(pivot, *--last)) {
+    }
+    while (!less(pivot, *++first)) {
+    }
+  }
+
+  T* pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+template <typename T, typename Less>
+void HeapSort(T* begin, T* end, Less& less) {
+  std::make_heap(begin, end, less);
+  std::sort_heap(begin, end, less);
+}
+
+// Swaps a few elements to break patterns which keep producing bad pivots.
+template <typename T>
+void BreakPatterns(T* begin, T* pivot_pos, T* end) {
+  const ptrdiff_t l_size = pivot_pos - begin;
+  const ptrdiff_t r_size = end - (pivot_pos + 1);
+  if (l_size >= kInsertionSortThreshold) {
+    std::iter_swap(begin, begin + l_size / 4);
+    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+    if (l_size > kNintherThreshold) {
+      std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+      std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+      std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+      std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+    }
+  }
+  if (r_size >= kInsertionSortThreshold) {
+    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+    std::iter_swap(end - 1, end - r_size / 4);
+    if (r_size > kNintherThreshold) {
+      std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+      std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+      std::iter_swap(end - 2, end - (1 + r_size / 4));
+      std::iter_swap(end - 3, end - (2 + r_size / 4));
+    }
+  }
+}
+
+// Pattern-defeating quicksort, see "Pattern-defeating Quicksort" by Orson
+// Peters. Falls back to heap sort after log2(n) unbalanced partitions.
+template <typename T, typename Less>
+void PdqSortLoop(T* begin, T* end, Less& less, int32_t bad_allowed,
+                 bool leftmost) {
+  while (true) {
+    const ptrdiff_t size = end - begin;
+    if (size < kInsertionSortThreshold) {
+      if constexpr (kIsBranchless<T, Less>) {
+        NetworkSort(begin, size);
+      } else if (leftmost) {
+        InsertionSort(begin, end, less);
+      } else {
+        UnguardedInsertionSort(begin, end, less);
+      }
+      return;
+    }
+
+    ChoosePivot(begin, end, less);
+
+    // The element before the range is the pivot of a previous partition and
+    // not greater than anything here. If it equals the new pivot, all equal
+    // elements are gathered on the left and need no further sorting.
+    if (!leftmost && !less(*(begin - 1), *begin)) {
+      begin = PartitionLeft(begin, end, less) + 1;
+      continue;
+    }
+
+    std::pair<T*, bool> part_result;
+    if constexpr (kIsBranchless<T, Less>) {
+      part_result = PartitionRightBranchless(begin, end, less);
+    } else {
+      part_result = PartitionRight(begin, end, less);
+    }
+    T* pivot_pos = part_result.first;
+    const bool already_partitioned = part_result.second;
+
+    const ptrdiff_t l_size = pivot_pos - begin;
+    const ptrdiff_t r_size = end - (pivot_pos + 1);
+    if (l_size < size / 8 || r_size < size / 8) {
+      if (--bad_allowed == 0) {
+        HeapSort(begin, end, less);
+        return;
+      }
+      BreakPatterns(begin, pivot_pos, end);
+    } else if (already_partitioned &&
+               PartialInsertionSort(begin, pivot_pos, less) &&
+               PartialInsertionSort(pivot_pos + 1, end, less)) {
+      return;
+    }
+
+    PdqSortLoop(begin, pivot_pos, less, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+template <RadixKeyType K>
+using RadixBits =
+    std::conditional_t<sizeof(K) == 1, uint8_t,
+                       std::conditional_t<sizeof(K) == 2, uint16_t,
+                                          std::conditional_t<sizeof(K) == 4,
+                                                             uint32_t,
+                                                             uint64_t>>>;
+
+// Maps a key to unsigned bits with the same order.
+template <RadixKeyType K>
+RadixBits<K> ToRadixBits(const K key) {
+  using U = RadixBits<K>;
+  constexpr U kSign = static_cast<U>(U(1) << (sizeof(U) * 8 - 1));
+  if constexpr (std::floating_point<K>) {
+    const U bits = std::bit_cast<U>(key);
+    return (bits & kSign) != 0 ? static_cast<U>(~bits)
+                               : static_cast<U>(bits | kSign);
+  } else if constexpr (std::is_signed_v<K>) {
+    return static_cast<U>(static_cast<U>(key) ^ kSign);
+  } else {
+    return static_cast<U>(key);
+  }
+}
+
+// Uninitialized storage for `cnt` elements of `T`, taken from the heap under
+// `MemoryTag::kArray` and released on scope exit.
+template <typename T>
+class TempBuffer {
+ public:
+  TempBuffer(const TempBuffer&) = delete;
+
+  explicit TempBuffer(const size_t cnt)
+      : cnt_(cnt),
+        data_(static_cast<T*>(HeapAllocator::Get(MemoryTag::kArray)
+                                  .Allocate(cnt * sizeof(T), alignof(T)))) {}
+  ~TempBuffer() {
+    HeapAllocator::Get(MemoryTag::kArray)
+        .Deallocate(data_, cnt_ * sizeof(T), alignof(T));
+  }
+
+  [[nodiscard]] T* Get() const { return data_; }
+
+ private:
+  size_t cnt_;
+  T* data_;
+};
+
+// LSD radix sort with 8-bit digits. All histograms are built in a single pass,
+// and digits shared by every element are skipped.
+template <typename T, typename KeyFn>
+void RadixSort(T* data, const size_t size, KeyFn& key_fn) {
+  using K = std::invoke_result_t<KeyFn&, const T&>;
+  constexpr size_t kDigitCnt = sizeof(K);
+  if (size < 2) {
+    return;
+  }
+
+  const TempBuffer<size_t[256]> count_buffer(kDigitCnt);
+  size_t(*counts)[256] = count_buffer.Get();
+  std::memset(counts, 0, kDigitCnt * sizeof(size_t[256]));
+  for (size_t i = 0; i < size; ++i) {
+    const auto bits = ToRadixBits<K>(key_fn(data[i]));
+    for (size_t d = 0; d < kDigitCnt; ++d) {
+      ++counts[d][(bits >> (d * 8)) & 0xFF];
+    }
+  }
+
+  const TempBuffer<T> buffer(size);
+  T* src = data;
+  T* dst = buffer.Get();
+  for (size_t d = 0; d < kDigitCnt; ++d) {
+    size_t* count = counts[d];
+    const auto first_bits = ToRadixBits<K>(key_fn(src[0]));
+    if (count[(first_bits >> (d * 8)) & 0xFF] == size) {
+      continue;
+    }
+    size_t offset = 0;
+    for (size_t b = 0; b < 256; ++b) {
+      const size_t cnt = count[b];
+      count[b] = offset;
+      offset += cnt;
+    }
+    for (size_t i = 0; i < size; ++i) {
+      const auto bits = ToRadixBits<K>(key_fn(src[i]));
+      std::memcpy(static_cast<void*>(dst + count[(bits >> (d * 8)) & 0xFF]++),
+                  static_cast<const void*>(src + i), sizeof(T));
+    }
+    std::swap(src, dst);
+  }
+  if (src != data) {
+    std::memcpy(static_cast<void*>(data), static_cast<const void*>(src),
+                size * sizeof(T));
+  }
+}
+
+template <typename T, typename Less>
+void MergeSort(T* begin, T* end, T* buffer, Less& less) {
+  const ptrdiff_t size = end - begin;
+  if (size <= kInsertionSortThreshold) {
+    InsertionSort(begin, end, less);
+    return;
+  }
+  T* mid = begin + size / 2;
+  MergeSort(begin, mid, buffer, less);
+  MergeSort(mid, end, buffer, less);
+  if (!less(*mid, *(mid - 1))) {
+    return;
+  }
+
+  // Move the left half out, then merge back. The right half never needs to be
+  // moved once the left half is exhausted.
+  const ptrdiff_t left_size = mid - begin;
+  for (ptrdiff_t i = 0; i < left_size; ++i) {
+    new (buffer + i) T(std::move(begin[i]));
+  }
+  T* left = buffer;
+  T* left_end = buffer + left_size;
+  T* right = mid;
+  T* out = begin;
+  while (left != left_end && right != end) {
+    if (less(*right, *left)) {
+      *out++ = std::move(*right++);
+    } else {
+      *out++ = std::move(*left++);
+    }
+  }
+  while (left != left_end) {
+    *out++ = std::move(*left++);
+  }
+  for (ptrdiff_t i = 0; i < left_size; ++i) {
+    buffer[i].~T();
+  }
+}
+
+}  // namespace sort_internal
+
+// Sorts [begin, end) with pattern-defeating quicksort. Large ranges of
+// integers or floats under the default order are radix sorted instead.
+template <std::movable T, typename Less = std::less<>>
+void Sort(T* begin, T* end, Less less = Less()) {
+  using namespace sort_internal;
+  const ptrdiff_t size = end - begin;
+  if constexpr (RadixKeyType<T> && kIsDefaultLess<Less>) {
+    if (size >= kRadixSortThreshold) {
+      auto key_fn = [](const T& val) { return val; };
+      RadixSort(begin, static_cast<size_t>(size), key_fn);
+      return;
+    }
+  }
+  if (size > 1) {
+    const auto bad_allowed =
+        static_cast<int32_t>(std::bit_width(static_cast<size_t>(size)));
+    PdqSortLoop(begin, end, less, bad_allowed, true);
+  }
+}
+
+// Sorts [begin, end) and keeps the relative order of equal elements.
+template <std::movable T, typename Less = std::less<>>
+void StableSort(T* begin, T* end, Less less = Less()) {
+  using namespace sort_internal;
+  const ptrdiff_t size = end - begin;
+  if constexpr (RadixKeyType<T> && kIsDefaultLess<Less>) {
+    if (size >= kRadixSortThreshold) {
+      auto key_fn = [](const T& val) { return val; };
+      RadixSort(begin, static_cast<size_t>(size), key_fn);
+      return;
+    }
+  }
+  if (size <= kInsertionSortThreshold) {
+    InsertionSort(begin, end, less);
+    return;
+  }
+  const TempBuffer<T> buffer(static_cast<size_t>(size / 2 + 1));
+  MergeSort(begin, end, buffer.Get(), less);
+}
+
+// Stable LSD radix sort on an integer or floating-point key of each element.
+template <typename T, typename KeyFn>
+  requires std::is_trivially_copyable_v<T> &&
+           RadixKeyType<std::invoke_result_t<KeyFn&, const T&>>
+void RadixSortByKey(T* begin, T* end, KeyFn key_fn) {
+  sort_internal::RadixSort(begin, static_cast<size_t>(end - begin), key_fn);
+}
+
+// Rearranges [begin, end) so that `nth` holds the element it would hold after
+// sorting, with nothing greater before it and nothing less after it.
+template <std::movable T, typename Less = std::less<>>
+void NthElement(T* begin, T* nth, T* end, Less less = Less()) {
+  using namespace sort_internal;
+  if (nth == end) {
+    return;
+  }
+  auto bad_allowed = static_cast<int32_t>(
+      std::bit_width(static_cast<size_t>(end - begin)));
+  while (end - begin >= kInsertionSortThreshold) {
+    ChoosePivot(begin, end, less);
+    T* pivot_pos = PartitionRight(begin, end, less).first;
+    if (pivot_pos == nth) {
+      return;
+    }
+
+    const ptrdiff_t size = end - begin;
+    const ptrdiff_t l_size = pivot_pos - begin;
+    const ptrdiff_t r_size = end - (pivot_pos + 1);
+    if (l_size < size / 8 || r_size < size / 8) {
+      if (--bad_allowed == 0) {
+        HeapSort(begin, end, less);
+        return;
+      }
+      BreakPatterns(begin, pivot_pos, end);
+    }
+
+    if (nth < pivot_pos) {
+      end = pivot_pos;
+    } else {
+      begin = pivot_pos + 1;
+    }
+  }
+  InsertionSort(begin, end, less);
+}
+
+// Sorts the smallest `middle - begin` elements into [begin, middle), the rest
+// are left in unspecified order.
+template <std::movable T, typename Less = std::less<>>
+void PartialSort(T* begin, T* middle, T* end, Less less = Less()) {
+  if (middle == begin) {
+    return;
+  }
+  NthElement(begin, middle - 1, end, less);
+  Sort(begin, middle - 1, less);
+}
+
+template <std::movable T, size_t ALIGN, typename Less = std::less<>>
+void Sort(Array<T, ALIGN>& array, Less less = Less()) {
+  T* data = array.GetRawPtr();
+  Sort(data, data + array.GetSize(), std::move(less));
+}
+
+template <std::movable T, size_t ALIGN, typename Less = std::less<>>
+void StableSort(Array<T, ALIGN>& array, Less less = Less()) {
+  T* data = array.GetRawPtr();
+  StableSort(data, data + array.GetSize(), std::move(less));
+}
+
+template <typename T, size_t ALIGN, typename KeyFn>
+  requires std::is_trivially_copyable_v<T> &&
+           RadixKeyType<std::invoke_result_t<KeyFn&, const T&>>
+void RadixSortByKey(Array<T, ALIGN>& array, KeyFn key_fn) {
+  T* data = array.GetRawPtr();
+  RadixSortByKey(data, data + array.GetSize(), std::move(key_fn));
+}
+
+template <std::movable T, size_t ALIGN, typename Less = std::less<>>
+void NthElement(Array<T, ALIGN>& array, const size_t nth, Less less = Less()) {
+  MIRAGE_DCHECK(nth <= array.GetSize());
+  T* data = array.GetRawPtr();
+  NthElement(data, data + nth, data + array.GetSize(), std::move(less));
+}
+
+template <std::movable T, size_t ALIGN, typename Less = std::less<>>
+void PartialSort(Array<T, ALIGN>& array, const size_t cnt, Less less = Less()) {
+  MIRAGE_DCHECK(cnt <= array.GetSize());
+  T* data = array.GetRawPtr();
+  PartialSort(data, data + cnt, data + array.GetSize(), std::move(less));
+}
+
+}  // namespace mirage::base
+
+#endif  // MIRAGE_BASE_UTIL_SORT
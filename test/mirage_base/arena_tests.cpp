@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/singly_linked_list.hpp"
+#include "mirage_base/memory/arena.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(ArenaTests, Allocate) {
+  Arena arena(256);
+  EXPECT_EQ(arena.GetUsedSize(), 0);
+  EXPECT_EQ(arena.GetReservedSize(), 0);
+
+  auto* a = static_cast<std::byte*>(arena.Allocate(1, 1));
+  auto* b = static_cast<std::byte*>(arena.Allocate(8, 8));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0);
+  EXPECT_EQ(b - a, 8);  // Bumped past the padding.
+  void* c = arena.Allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % 64, 0);
+  EXPECT_EQ(arena.GetReservedSize(), 256);
+
+  // Larger than a chunk, gets a dedicated chunk.
+  void* big = arena.Allocate(1024, 16);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(big) % 16, 0);
+  EXPECT_GT(arena.GetReservedSize(), 256 + 1024);
+  EXPECT_GE(arena.GetUsedSize(), 256 + 1024);
+}
+
+TEST(ArenaTests, ResetKeepsChunks) {
+  Arena arena(128);
+  void* first = arena.Allocate(100, 8);
+  arena.Allocate(100, 8);
+  const size_t reserved = arena.GetReservedSize();
+
+  arena.Reset();
+  EXPECT_EQ(arena.GetUsedSize(), 0);
+  EXPECT_EQ(arena.Allocate(100, 8), first);
+  arena.Allocate(100, 8);
+  EXPECT_EQ(arena.GetReservedSize(), reserved);
+}
+
+TEST(ArenaTests, MarkAndRewind) {
+  int32_t destruct_cnt = 0;
+  {
+    Arena arena(128);
+    arena.New<Counter>(&destruct_cnt);
+    const Arena::Marker marker = arena.Mark();
+    const size_t used = arena.GetUsedSize();
+    void* after_mark = arena.Allocate(8, 8);
+    arena.New<Counter>(&destruct_cnt);
+    arena.New<Counter>(&destruct_cnt);
+    arena.Allocate(256, 8);
+
+    arena.Rewind(marker);
+    EXPECT_EQ(destruct_cnt, 2);
+    EXPECT_EQ(arena.GetUsedSize(), used);
+    EXPECT_EQ(arena.Allocate(8, 8), after_mark);
+
+    {
+      const ArenaScope scope(arena);
+      arena.New<Counter>(&destruct_cnt);
+    }
+    EXPECT_EQ(destruct_cnt, 3);
+    EXPECT_EQ(*arena.New<int32_t>(7), 7);  // Trivial, nothing registered.
+  }
+  EXPECT_EQ(destruct_cnt, 4);
+}
+
+TEST(ArenaTests, Containers) {
+  Arena arena(1024);
+  int32_t destruct_cnt = 0;
+  {
+    Array<Owned<Counter>> array(arena);
+    EXPECT_EQ(&array.GetAllocator(), &arena);
+    for (int32_t i = 0; i < 10; ++i) {
+      array.Emplace(Owned<Counter>::New(&destruct_cnt));
+    }
+    EXPECT_GT(arena.GetUsedSize(), 10 * sizeof(Owned<Counter>));
+    const Array<Owned<Counter>> move_array(std::move(array));
+    EXPECT_EQ(&move_array.GetAllocator(), &arena);
+  }
+  EXPECT_EQ(destruct_cnt, 10);
+
+  arena.Reset();
+  SinglyLinkedList<int32_t> list(arena);
+  list.PushTail(0);
+  list.PushTail(1);
+  EXPECT_GT(arena.GetUsedSize(), 0);
+  const SinglyLinkedList<int32_t> copy_list(list);
+  EXPECT_EQ(&copy_list.GetAllocator(), &HeapAllocator::Get(MemoryTag::kList));
+  int32_t cnt = 0;
+  for (const int32_t num : copy_list) {
+    EXPECT_EQ(num, cnt);
+    ++cnt;
+  }
+  EXPECT_EQ(cnt, 2);
+}
@@ -2,6 +2,7 @@
 
 #include "mirage_base/auto_ptr/owned.hpp"
 #include "mirage_base/container/array.hpp"
+#include "mirage_base/util/sort.hpp"
 
 using namespace mirage::base;
 
@@ -72,6 +73,26 @@ TEST(ArrayTests, ChangeSizeAndCapacity) {
   EXPECT_EQ(array.GetCapacity(), 5);
 }
 
+TEST(ArrayTests, OverAligned) {
+  Array<float, 64> array;
+  for (int32_t i = 0; i < 100; ++i) {
+    array.Push(static_cast<float>(i));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(array.GetRawPtr()) % 64, 0);
+  }
+  EXPECT_EQ(&array[1] - &array[0], 1);  // Elements stay packed.
+
+  const Array<float, 64> copy_array(array);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(copy_array.GetRawPtr()) % 64, 0);
+  EXPECT_EQ(copy_array[99], 99.0f);
+
+  Array<float, 64> sorted;
+  for (int32_t i = 99; i >= 0; --i) {
+    sorted.Push(static_cast<float>(i));
+  }
+  Sort(sorted);
+  EXPECT_EQ(sorted, copy_array);
+}
+
 TEST(ArrayTests, CompareEquality) {
   const Array<int32_t> array_a = {0, 1, 2};
   const Array<int32_t> array_b = {2, 1, 0};
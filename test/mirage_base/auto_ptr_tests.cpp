@@ -4,6 +4,7 @@
 
 #include "mirage_base/auto_ptr/owned.hpp"
 #include "mirage_base/auto_ptr/ref_count.hpp"
+#include "mirage_base/memory/arena.hpp"
 
 using namespace mirage::base;
 
@@ -67,6 +68,12 @@ TEST(AutoPtrTests, OwnedPtrOps) {
 
   *owned_flag->base_destructed = true;
   EXPECT_EQ(*owned_flag->base_destructed, 1);
+
+  // Only allocator owners pay for the allocator.
+  if (!MemoryTracker::kIsEnabled) {
+    EXPECT_EQ(sizeof(Owned<Base>), sizeof(Base*));
+  }
+  EXPECT_GT(sizeof(AllocatorOwned<Base>), sizeof(Base*));
 }
 
 TEST(AutoPtrTests, OwnedConvertDeriveToBase) {
@@ -85,6 +92,31 @@ TEST(AutoPtrTests, OwnedConvertDeriveToBase) {
   EXPECT_EQ(derive_destructed, 1);
 }
 
+TEST(AutoPtrTests, OwnedConvertInAllocator) {
+  struct Other {
+    virtual ~Other() = default;
+    int64_t payload{0};
+  };
+  struct Multi final : Other, Base {
+    explicit Multi(int32_t* base_destructed) : Base(base_destructed) {}
+  };
+
+  // Freed in the allocator it came from with its original size, also when
+  // held by a base at an offset.
+  int32_t base_destructed = 0;
+  Arena arena;
+  auto multi = AllocatorOwned<Multi>::NewIn(arena, &base_destructed);
+  const void* ptr = multi.Get();
+  AllocatorOwned<Base> base = multi.Convert<Base>();
+  EXPECT_NE(static_cast<const void*>(base.Get()), ptr);
+  const size_t used = arena.GetUsedSize();
+  base = base.TryConvert<Multi>().Convert<Base>();
+  EXPECT_EQ(arena.GetUsedSize(), used);
+  base.Reset();
+  EXPECT_EQ(base_destructed, 1);
+  EXPECT_EQ(arena.GetUsedSize(), 0);
+}
+
 TEST(AutoPtrTests, OwnedConvertBaseToDerive) {
   // Can't convert from base to derive when base is the origin type.
   int32_t base_destructed = 0;
@@ -108,6 +140,7 @@ TEST(AutoPtrTests, OwnedConvertBaseToDerive) {
 TEST(AutoPtrTests, RefCountOps) {
   EXPECT_TRUE(AsRefCount<RefCountLocal>);
   EXPECT_TRUE(AsRefCount<RefCountAsync>);
+  EXPECT_TRUE(AsRefCount<RefCountAtomic>);
 
   auto checker = [](RefCount* count) {
     EXPECT_EQ(count->GetCnt(), 0);
@@ -145,6 +178,9 @@ TEST(AutoPtrTests, RefCountOps) {
 
   RefCountAsync count_async;
   checker(&count_async);
+
+  RefCountAtomic count_atomic;
+  checker(&count_atomic);
 }
 
 TEST(AutoPtrTests, CountAsync) {
@@ -161,3 +197,18 @@ TEST(AutoPtrTests, CountAsync) {
   async_thread.join();
   EXPECT_EQ(count_async.GetCnt(), 20000);
 }
+
+TEST(AutoPtrTests, CountAtomic) {
+  RefCountAtomic count_atomic;
+  auto async_operation = [&count_atomic] {
+    for (int32_t i = 0; i < 10000; ++i) {
+      count_atomic.Increase();
+      count_atomic.TryIncrease();
+      count_atomic.TryRelease();
+    }
+  };
+  std::thread async_thread(async_operation);
+  async_operation();
+  async_thread.join();
+  EXPECT_EQ(count_atomic.GetCnt(), 20000);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/container/bit_array.hpp"
+
+using namespace mirage::base;
+
+TEST(BitArrayTests, Construct) {
+  BitArray bits(100);
+  EXPECT_EQ(bits.GetSize(), 100);
+  EXPECT_EQ(bits.GetWordCnt(), 2);
+  EXPECT_EQ(bits.PopCount(), 0);
+
+  bits.Set(3);
+  const BitArray copy_bits(bits);
+  EXPECT_EQ(copy_bits, bits);
+
+  const BitArray move_bits(std::move(bits));
+  EXPECT_TRUE(bits.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_TRUE(move_bits.Test(3));
+}
+
+TEST(BitArrayTests, SetAndTest) {
+  BitArray bits;
+  for (int32_t i = 0; i < 130; ++i) {
+    bits.Push(i % 3 == 0);
+  }
+  EXPECT_EQ(bits.GetSize(), 130);
+  EXPECT_EQ(bits.PopCount(), 44);
+  EXPECT_TRUE(bits.Test(129));
+  EXPECT_FALSE(bits.Test(128));
+
+  bits.Reset(129);
+  bits.Flip(128);
+  EXPECT_FALSE(bits.Test(129));
+  EXPECT_TRUE(bits.Test(128));
+
+  bits.SetAll();
+  EXPECT_EQ(bits.PopCount(), 130);
+  bits.SetSize(70);
+  EXPECT_EQ(bits.PopCount(), 70);
+  bits.SetSize(200);
+  EXPECT_EQ(bits.PopCount(), 70);
+  bits.ResetAll();
+  EXPECT_EQ(bits.PopCount(), 0);
+}
+
+TEST(BitArrayTests, FindSetBits) {
+  BitArray bits(300);
+  EXPECT_EQ(bits.FindFirstSet(), 300);
+  bits.Set(5);
+  bits.Set(64);
+  bits.Set(299);
+  EXPECT_EQ(bits.FindFirstSet(), 5);
+  EXPECT_EQ(bits.FindNextSet(5), 64);
+  EXPECT_EQ(bits.FindNextSet(64), 299);
+  EXPECT_EQ(bits.FindNextSet(299), 300);
+
+  size_t sum = 0;
+  size_t cnt = 0;
+  bits.ForEachSetBit([&](const size_t index) {
+    sum += index;
+    ++cnt;
+  });
+  EXPECT_EQ(cnt, 3);
+  EXPECT_EQ(sum, 5 + 64 + 299);
+}
+
+TEST(BitArrayTests, BitwiseOps) {
+  BitArray lhs(100);
+  BitArray rhs(100);
+  lhs.Set(1);
+  lhs.Set(2);
+  rhs.Set(2);
+  rhs.Set(99);
+
+  BitArray bits = lhs;
+  bits.And(rhs);
+  EXPECT_EQ(bits.PopCount(), 1);
+  EXPECT_TRUE(bits.Test(2));
+
+  bits = lhs;
+  bits.Or(rhs);
+  EXPECT_EQ(bits.PopCount(), 3);
+
+  bits = lhs;
+  bits.Xor(rhs);
+  EXPECT_EQ(bits.PopCount(), 2);
+  EXPECT_FALSE(bits.Test(2));
+
+  bits = lhs;
+  bits.AndNot(rhs);
+  EXPECT_EQ(bits.PopCount(), 1);
+  EXPECT_TRUE(bits.Test(1));
+
+  // Operands may be the same array.
+  bits = lhs;
+  bits.And(bits);
+  EXPECT_EQ(bits, lhs);
+  bits.Or(bits);
+  EXPECT_EQ(bits, lhs);
+  bits.Xor(bits);
+  EXPECT_EQ(bits.PopCount(), 0);
+  bits = lhs;
+  bits.AndNot(bits);
+  EXPECT_EQ(bits.PopCount(), 0);
+}
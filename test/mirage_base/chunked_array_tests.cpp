@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/chunked_array.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(ChunkedArrayTests, Construct) {
+  ChunkedArray<int32_t, 2> array = {0, 1, 2};
+  EXPECT_EQ(array.GetSize(), 3);
+  EXPECT_EQ(array.GetCapacity(), 4);
+
+  const ChunkedArray<int32_t, 2> copy_array(array);
+  EXPECT_EQ(copy_array.GetSize(), 3);
+  EXPECT_EQ(copy_array[2], 2);
+
+  int32_t* raw_ptr = &array[0];
+  const ChunkedArray<int32_t, 2> move_array(std::move(array));
+  EXPECT_TRUE(array.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(raw_ptr, &move_array[0]);
+  EXPECT_EQ(move_array.TryGet(3), nullptr);
+}
+
+TEST(ChunkedArrayTests, PointerStableOnGrowth) {
+  ChunkedArray<int32_t, 4> array;
+  int32_t* first = &array.Emplace(0);
+  int32_t* fifth = nullptr;
+  for (int32_t i = 1; i < 100; ++i) {
+    int32_t& ref = array.Emplace(i);
+    if (i == 4) {
+      fifth = &ref;
+    }
+  }
+  EXPECT_EQ(first, &array[0]);
+  EXPECT_EQ(fifth, &array[4]);
+  EXPECT_EQ(*fifth, 4);
+  EXPECT_EQ(array.Pop(), 99);
+  EXPECT_EQ(array.GetSize(), 99);
+}
+
+TEST(ChunkedArrayTests, IterateChunks) {
+  ChunkedArray<int32_t, 4> array;
+  for (int32_t i = 0; i < 10; ++i) {
+    array.Emplace(i);
+  }
+  EXPECT_EQ(array.GetChunkCnt(), 3);
+  EXPECT_EQ(array.GetChunk(0).GetSize(), 4);
+  EXPECT_EQ(array.GetChunk(2).GetSize(), 2);
+
+  for (size_t chunk = 0; chunk < array.GetChunkCnt(); ++chunk) {
+    for (int32_t& num : array.GetChunk(chunk)) {
+      num += 1;
+    }
+  }
+  int32_t expected = 1;
+  for (const int32_t num : array) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 11);
+}
+
+TEST(ChunkedArrayTests, DestructElements) {
+  int32_t destruct_cnt = 0;
+  {
+    ChunkedArray<Owned<Counter>, 2> array;
+    array.Emplace(Owned<Counter>::New(&destruct_cnt));
+    array.Emplace(Owned<Counter>::New(&destruct_cnt));
+    array.Emplace(Owned<Counter>::New(&destruct_cnt));
+    const Owned<Counter> pop = array.Pop();
+    EXPECT_EQ(destruct_cnt, 0);
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/condition_variable.hpp"
+
+using namespace mirage::base;
+
+TEST(ConditionVariableTests, ProduceConsume) {
+  constexpr int32_t kItemCnt = 1000;
+
+  Lock lock;
+  ConditionVariable not_empty;
+  Array<int32_t> queue;
+  bool is_done = false;
+  int32_t sum = 0;
+  std::thread consumer([&] {
+    LockGuard guard(lock);
+    while (true) {
+      while (queue.IsEmpty() && !is_done) {
+        not_empty.Wait(lock);
+      }
+      if (queue.IsEmpty()) {
+        break;
+      }
+      sum += queue.Pop();
+    }
+  });
+  for (int32_t i = 1; i <= kItemCnt; ++i) {
+    LockGuard guard(lock);
+    queue.Push(i);
+    not_empty.NotifyOne();
+  }
+  {
+    LockGuard guard(lock);
+    is_done = true;
+  }
+  not_empty.NotifyAll();
+  consumer.join();
+  EXPECT_EQ(sum, kItemCnt * (kItemCnt + 1) / 2);
+}
+
+TEST(ConditionVariableTests, WaitFor) {
+  Lock lock;
+  ConditionVariable cv;
+  LockGuard guard(lock);
+  const auto begin = std::chrono::steady_clock::now();
+  EXPECT_FALSE(cv.WaitFor(lock, std::chrono::milliseconds(5)));
+  EXPECT_GE(std::chrono::steady_clock::now() - begin,
+            std::chrono::milliseconds(5));
+  EXPECT_FALSE(lock.TryAcquire());  // Held again after the wait.
+}
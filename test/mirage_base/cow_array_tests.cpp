@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/container/cow_array.hpp"
+
+using namespace mirage::base;
+
+TEST(CowArrayTests, Construct) {
+  const CowArray<int32_t> empty;
+  EXPECT_TRUE(empty.IsEmpty());
+  EXPECT_EQ(empty.TryGet(0), nullptr);
+
+  CowArray<int32_t> array = {0, 1, 2};
+  EXPECT_EQ(array.GetSize(), 3);
+  EXPECT_FALSE(array.IsShared());
+
+  const CowArray<int32_t> copy_array(array);
+  EXPECT_TRUE(array.IsShared());
+  EXPECT_EQ(&array[0], &copy_array[0]);
+
+  const CowArray<int32_t> move_array(std::move(array));
+  EXPECT_TRUE(array.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(move_array, copy_array);
+}
+
+TEST(CowArrayTests, CloneOnWrite) {
+  CowArray<int32_t> array = {0, 1, 2};
+  const int32_t* origin = &array[0];
+
+  // Not shared, write in place.
+  array.GetMut(0) = 10;
+  EXPECT_EQ(&array[0], origin);
+
+  const CowArray<int32_t> snapshot(array);
+  array.GetMut(1) = 11;
+  EXPECT_NE(&array[0], origin);
+  EXPECT_EQ(&snapshot[0], origin);
+  EXPECT_FALSE(array.IsShared());
+  EXPECT_FALSE(snapshot.IsShared());
+  EXPECT_EQ(snapshot[1], 1);
+  EXPECT_EQ(array[1], 11);
+
+  array.Push(3);
+  EXPECT_EQ(array.Pop(), 3);
+  EXPECT_EQ(snapshot.GetSize(), 3);
+}
+
+TEST(CowArrayTests, SnapshotToThread) {
+  CowArray<int32_t> array;
+  for (int32_t i = 0; i < 1000; ++i) {
+    array.Push(i);
+  }
+  const CowArray<int32_t> snapshot(array);
+  int64_t sum = 0;
+  std::thread reader([&sum, snapshot] {
+    for (const int32_t num : snapshot) {
+      sum += num;
+    }
+  });
+  for (int32_t i = 0; i < 1000; ++i) {
+    array.GetMut(i) = 0;
+  }
+  reader.join();
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+  EXPECT_EQ(array[999], 0);
+}
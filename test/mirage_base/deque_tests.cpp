@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/deque.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(DequeTests, Construct) {
+  Deque<int32_t> deque = {0, 1, 2};
+  EXPECT_EQ(deque.GetSize(), 3);
+  EXPECT_EQ(deque.GetCapacity(), 4);
+
+  const Deque<int32_t> copy_deque(deque);
+  EXPECT_EQ(copy_deque.GetSize(), 3);
+  EXPECT_EQ(copy_deque[2], 2);
+
+  const Deque<int32_t> move_deque(std::move(deque));
+  EXPECT_TRUE(deque.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(move_deque.GetFront(), 0);
+  EXPECT_EQ(move_deque.GetBack(), 2);
+  EXPECT_EQ(move_deque.TryGet(3), nullptr);
+}
+
+TEST(DequeTests, PushAndPopBothEnds) {
+  Deque<int32_t> deque;
+  for (int32_t i = 0; i < 5; ++i) {
+    deque.PushBack(i);
+    deque.PushFront(-i - 1);
+  }
+  EXPECT_EQ(deque.GetSize(), 10);
+  int32_t expected = -5;
+  for (const int32_t num : deque) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(deque.PopFront(), -5);
+  EXPECT_EQ(deque.PopBack(), 4);
+  EXPECT_EQ(deque[0], -4);
+  EXPECT_EQ(deque.GetSize(), 8);
+}
+
+TEST(DequeTests, SpansWrapAround) {
+  Deque<int32_t> deque;
+  deque.Reserve(4);
+  deque.PushBack(0);
+  deque.PushBack(1);
+  deque.PushBack(2);
+  deque.PopFront();
+  deque.PopFront();
+  deque.PushBack(3);
+  deque.PushBack(4);  // Wrap to the front of buffer.
+
+  const auto spans = deque.GetSpans();
+  ASSERT_EQ(spans.head.GetSize(), 2);
+  ASSERT_EQ(spans.tail.GetSize(), 1);
+  EXPECT_EQ(spans.head[0], 2);
+  EXPECT_EQ(spans.head[1], 3);
+  EXPECT_EQ(spans.tail[0], 4);
+}
+
+TEST(DequeTests, FixedRingBuffer) {
+  RingBuffer<int32_t, 4> ring;
+  EXPECT_EQ(ring.GetCapacity(), 4);
+  for (int32_t i = 0; i < 4; ++i) {
+    ring.PushBack(i);
+  }
+  EXPECT_TRUE(ring.IsFull());
+  EXPECT_EQ(ring.PopFront(), 0);
+  ring.PushBack(4);
+  EXPECT_EQ(ring.GetCapacity(), 4);
+
+  RingBuffer<int32_t, 4> move_ring(std::move(ring));
+  EXPECT_TRUE(ring.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  int32_t expected = 1;
+  for (const int32_t num : move_ring) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+}
+
+TEST(DequeTests, DestructElements) {
+  int32_t destruct_cnt = 0;
+  {
+    Deque<Owned<Counter>> deque;
+    deque.EmplaceBack(Owned<Counter>::New(&destruct_cnt));
+    deque.EmplaceFront(Owned<Counter>::New(&destruct_cnt));
+    RingBuffer<Owned<Counter>, 2> ring;
+    ring.EmplaceBack(Owned<Counter>::New(&destruct_cnt));
+    const Owned<Counter> pop = deque.PopBack();
+    EXPECT_EQ(destruct_cnt, 0);
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/event.hpp"
+
+using namespace mirage::base;
+
+TEST(EventTests, ManualReset) {
+  ManualResetEvent event;
+  EXPECT_FALSE(event.WaitFor(std::chrono::milliseconds(1)));
+
+  std::atomic<int32_t> passed_cnt = 0;
+  Array<std::thread> threads;
+  for (int32_t i = 0; i < 3; ++i) {
+    threads.Emplace([&] {
+      event.Wait();
+      passed_cnt.fetch_add(1);
+    });
+  }
+  event.Set();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(passed_cnt.load(), 3);
+  EXPECT_TRUE(event.IsSet());  // Stays set for later waiters.
+  event.Wait();
+  event.Reset();
+  EXPECT_FALSE(event.IsSet());
+}
+
+TEST(EventTests, AutoReset) {
+  AutoResetEvent event(true);
+  EXPECT_TRUE(event.TryWait());
+  EXPECT_FALSE(event.TryWait());  // Reset by the waiter.
+  event.Set();
+  event.Set();  // Lost, the event is already set.
+  EXPECT_TRUE(event.WaitFor(std::chrono::milliseconds(1)));
+  EXPECT_FALSE(event.WaitFor(std::chrono::milliseconds(1)));
+
+  // Ping pong, each set releases exactly one wait.
+  AutoResetEvent pong;
+  std::thread thread([&] {
+    for (int32_t i = 0; i < 100; ++i) {
+      event.Wait();
+      pong.Set();
+    }
+  });
+  for (int32_t i = 0; i < 100; ++i) {
+    event.Set();
+    pong.Wait();
+  }
+  thread.join();
+  EXPECT_FALSE(event.TryWait());
+}
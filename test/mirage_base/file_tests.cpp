@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/file/file.hpp"
+#include "mirage_base/file/file_stream.hpp"
+#include "mirage_base/file/mapped_file.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+std::string GetTempPath(const char* name) { return testing::TempDir() + name; }
+
+}  // namespace
+
+TEST(FileTests, ReadWriteAt) {
+  const std::string path = GetTempPath("mirage_file_tests_rw");
+  {
+    const File file(path.c_str(), {.mode = File::Mode::kWrite});
+    ASSERT_TRUE(file.IsValid());
+    const std::byte data[] = {std::byte{1}, std::byte{2}, std::byte{3}};
+    EXPECT_TRUE(file.WriteAt(Span<const std::byte>(data), 4));
+    EXPECT_EQ(file.GetSize().Unwrap(), 7);  // Zero filled up to the offset.
+    EXPECT_TRUE(file.SetSize(6));
+  }
+
+  const File file(path.c_str(), {.mode = File::Mode::kRead});
+  ASSERT_TRUE(file.IsValid());
+  std::byte data[8] = {};
+  EXPECT_EQ(file.ReadAt(Span<std::byte>(data), 2).Unwrap(), 4);
+  EXPECT_EQ(data[0], std::byte{0});
+  EXPECT_EQ(data[2], std::byte{1});
+  EXPECT_EQ(data[3], std::byte{2});
+  EXPECT_EQ(file.ReadAt(Span<std::byte>(data), 6).Unwrap(), 0);
+
+  const std::string missing = GetTempPath("mirage_file_tests_missing");
+  EXPECT_FALSE(File(missing.c_str(), {.mode = File::Mode::kRead}).IsValid());
+  EXPECT_FALSE(MappedFile(missing.c_str()).IsValid());
+  EXPECT_FALSE(FileReader(missing.c_str()).IsValid());
+  std::remove(path.c_str());
+}
+
+TEST(FileTests, MappedFile) {
+  const std::string path = GetTempPath("mirage_file_tests_mapped");
+  {
+    const MappedFile file(path.c_str(), 10000, {});
+    ASSERT_TRUE(file.IsValid());
+    EXPECT_EQ(file.GetAccess(), MappedFile::Access::kReadWrite);
+    const Span<std::byte> bytes = file.GetWritableBytes();
+    EXPECT_EQ(bytes.GetSize(), 10000);
+    for (size_t i = 0; i < bytes.GetSize(); ++i) {
+      bytes[i] = static_cast<std::byte>(i);
+    }
+    EXPECT_TRUE(file.Flush());
+  }
+
+  MappedFile file(path.c_str(), {.advice = MappedFile::Advice::kSequential,
+                                 .populate = true});
+  ASSERT_TRUE(file.IsValid());
+  file.Advise(MappedFile::Advice::kRandom, 5000, 100);
+  const Span<const std::byte> bytes = file.GetBytes();
+  EXPECT_EQ(bytes.GetSize(), 10000);
+  EXPECT_EQ(bytes[255], std::byte{255});
+  EXPECT_EQ(bytes[9999], static_cast<std::byte>(9999));
+
+  const MappedFile moved(std::move(file));
+  EXPECT_FALSE(file.IsValid());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(moved.GetBytes()[9999], static_cast<std::byte>(9999));
+  std::remove(path.c_str());
+}
+
+TEST(FileTests, Stream) {
+  const std::string path = GetTempPath("mirage_file_tests_stream");
+  for (const bool direct : {false, true}) {
+    const FileStreamOptions options{.buffer_size = 1, .direct = direct};
+    Array<std::byte> data;
+    for (size_t i = 0; i < 10000; ++i) {
+      data.Push(static_cast<std::byte>(i * 7));
+    }
+    {
+      FileWriter writer(path.c_str(), options);
+      ASSERT_TRUE(writer.IsValid());
+      const Span<const std::byte> bytes(data);
+      EXPECT_TRUE(writer.Write(bytes.First(3)));
+      EXPECT_TRUE(writer.Flush());  // Flushes a partial block.
+      EXPECT_TRUE(writer.Write(bytes.Subspan(3)));
+      EXPECT_EQ(writer.GetOffset(), 10000);
+    }
+
+    FileReader reader(path.c_str(), options);
+    ASSERT_TRUE(reader.IsValid());
+    std::byte small[5];
+    EXPECT_EQ(reader.Read(Span<std::byte>(small)), 5);
+    EXPECT_EQ(small[4], data[4]);
+    std::byte rest[20000];
+    EXPECT_EQ(reader.Read(Span<std::byte>(rest)), 9995);
+    EXPECT_TRUE(reader.IsEnd());
+    EXPECT_FALSE(reader.IsFailed());
+    EXPECT_EQ(reader.GetOffset(), 10000);
+    for (size_t i = 0; i < 9995; ++i) {
+      EXPECT_EQ(rest[i], data[i + 5]);
+    }
+  }
+  std::remove(path.c_str());
+}
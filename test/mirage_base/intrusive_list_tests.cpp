@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/intrusive_list.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Object final {
+  int32_t val{0};
+  IntrusiveListHook dirty_hook;
+  IntrusiveListHook free_hook;
+  IntrusiveSListHook pending_hook;
+
+  explicit Object(const int32_t val) : val(val) {}
+};
+
+using DirtyList = IntrusiveList<Object, &Object::dirty_hook>;
+using FreeList = IntrusiveList<Object, &Object::free_hook>;
+using PendingList = IntrusiveSList<Object, &Object::pending_hook>;
+
+template <typename List>
+Array<int32_t> Collect(const List& list) {
+  Array<int32_t> vals;
+  for (const Object& obj : list) {
+    vals.Push(obj.val);
+  }
+  return vals;
+}
+
+}  // namespace
+
+TEST(IntrusiveListTests, PushAndPop) {
+  EXPECT_TRUE(std::bidirectional_iterator<DirtyList::Iterator>);
+  EXPECT_TRUE(std::bidirectional_iterator<DirtyList::ConstIterator>);
+
+  Object a(0), b(1), c(2);
+  DirtyList list;
+  EXPECT_TRUE(list.IsEmpty());
+  EXPECT_EQ(list.GetFront(), nullptr);
+  EXPECT_EQ(list.PopBack(), nullptr);
+
+  list.PushBack(b);
+  list.PushBack(c);
+  list.PushFront(a);
+  EXPECT_EQ(list.GetSize(), 3);
+  EXPECT_EQ(Collect(list), (Array<int32_t>{0, 1, 2}));
+  EXPECT_EQ(list.GetFront(), &a);
+  EXPECT_EQ(list.GetBack(), &c);
+  EXPECT_EQ((--list.end())->val, 2);
+
+  EXPECT_EQ(list.PopFront(), &a);
+  EXPECT_EQ(list.PopBack(), &c);
+  EXPECT_FALSE(DirtyList::IsLinked(a));
+  EXPECT_TRUE(DirtyList::IsLinked(b));
+  EXPECT_EQ(Collect(list), (Array<int32_t>{1}));
+}
+
+TEST(IntrusiveListTests, UnlinkAnywhere) {
+  Object a(0), b(1), c(2);
+  DirtyList dirty_list;
+  FreeList free_list;
+  dirty_list.PushBack(a);
+  dirty_list.PushBack(b);
+  dirty_list.PushBack(c);
+  free_list.PushBack(b);  // In two lists through different hooks.
+
+  DirtyList::Remove(b);
+  EXPECT_EQ(Collect(dirty_list), (Array<int32_t>{0, 2}));
+  EXPECT_EQ(Collect(free_list), (Array<int32_t>{1}));
+
+  DirtyList::InsertAfter(a, b);
+  EXPECT_EQ(Collect(dirty_list), (Array<int32_t>{0, 1, 2}));
+  DirtyList::Remove(c);
+  DirtyList::InsertBefore(a, c);
+  EXPECT_EQ(Collect(dirty_list), (Array<int32_t>{2, 0, 1}));
+
+  {
+    Object d(3);
+    dirty_list.PushBack(d);
+    EXPECT_EQ(dirty_list.GetSize(), 4);
+  }  // Hook unlinks itself on destruction.
+  EXPECT_EQ(Collect(dirty_list), (Array<int32_t>{2, 0, 1}));
+
+  dirty_list.Clear();
+  EXPECT_FALSE(DirtyList::IsLinked(a));
+  EXPECT_TRUE(FreeList::IsLinked(b));
+}
+
+TEST(IntrusiveListTests, SpliceAndMove) {
+  Object a(0), b(1), c(2), d(3);
+  DirtyList list_a;
+  DirtyList list_b;
+  list_a.PushBack(b);
+  list_b.PushBack(c);
+  list_b.PushBack(d);
+
+  list_a.SpliceBack(list_b);
+  EXPECT_TRUE(list_b.IsEmpty());
+  EXPECT_EQ(Collect(list_a), (Array<int32_t>{1, 2, 3}));
+
+  list_b.PushBack(a);
+  list_a.SpliceFront(list_b);
+  EXPECT_EQ(Collect(list_a), (Array<int32_t>{0, 1, 2, 3}));
+
+  DirtyList move_list(std::move(list_a));
+  EXPECT_TRUE(list_a.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(Collect(move_list), (Array<int32_t>{0, 1, 2, 3}));
+  DirtyList::Remove(d);
+  EXPECT_EQ(move_list.GetBack(), &c);
+
+  const Object copy(a);
+  EXPECT_FALSE(DirtyList::IsLinked(copy));
+}
+
+TEST(IntrusiveSListTests, PushAndPop) {
+  EXPECT_TRUE(std::forward_iterator<PendingList::Iterator>);
+  EXPECT_TRUE(std::forward_iterator<PendingList::ConstIterator>);
+
+  Object a(0), b(1), c(2);
+  PendingList list;
+  EXPECT_TRUE(list.IsEmpty());
+  EXPECT_EQ(list.PopFront(), nullptr);
+
+  list.PushBack(b);
+  list.PushFront(a);
+  list.PushBack(c);
+  EXPECT_EQ(list.GetSize(), 3);
+  EXPECT_EQ(Collect(list), (Array<int32_t>{0, 1, 2}));
+  EXPECT_EQ(list.GetBack(), &c);
+
+  EXPECT_EQ(list.RemoveAfter(b), &c);
+  EXPECT_EQ(list.GetBack(), &b);
+  list.InsertAfter(b, c);
+  EXPECT_EQ(list.GetBack(), &c);
+  EXPECT_EQ(list.RemoveAfter(a), &b);
+  EXPECT_EQ(Collect(list), (Array<int32_t>{0, 2}));
+
+  EXPECT_EQ(list.PopFront(), &a);
+  EXPECT_EQ(list.PopFront(), &c);
+  EXPECT_TRUE(list.IsEmpty());
+  EXPECT_EQ(list.GetBack(), nullptr);
+}
+
+TEST(IntrusiveSListTests, SpliceAndMove) {
+  Object a(0), b(1), c(2), d(3);
+  PendingList list_a;
+  PendingList list_b;
+  list_a.PushBack(b);
+  list_b.PushBack(c);
+  list_b.PushBack(d);
+
+  list_a.SpliceBack(list_b);
+  EXPECT_TRUE(list_b.IsEmpty());
+  EXPECT_EQ(Collect(list_a), (Array<int32_t>{1, 2, 3}));
+
+  list_b.PushBack(a);
+  list_a.SpliceFront(list_b);
+  EXPECT_EQ(Collect(list_a), (Array<int32_t>{0, 1, 2, 3}));
+  EXPECT_EQ(list_a.GetBack(), &d);
+
+  PendingList move_list(std::move(list_a));
+  EXPECT_TRUE(list_a.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(Collect(move_list), (Array<int32_t>{0, 1, 2, 3}));
+  move_list.Clear();
+}
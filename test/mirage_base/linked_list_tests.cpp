@@ -114,3 +114,114 @@ TEST(SinglyLinkedListTests, MoveAndCopy) {
   }
   EXPECT_EQ(cnt, 2);
 }
+
+TEST(SinglyLinkedListTests, InsertAndRemoveAfter) {
+  SinglyLinkedList<int32_t> list = {0, 2, 3};
+  list.begin().InsertAfter(1);
+  EXPECT_EQ((++list.begin()).RemoveAfter(), 2);  // Keeps the rest linked.
+
+  int32_t expected[] = {0, 1, 3};
+  int32_t i = 0;
+  for (int32_t num : list) {
+    EXPECT_EQ(num, expected[i]);
+    ++i;
+  }
+  EXPECT_EQ(i, 3);
+
+  auto iter = list.begin();
+  ++iter;
+  EXPECT_EQ(iter.RemoveAfter(), 3);  // Removes the tail.
+  list.PushTail(4);
+  iter.EmplaceAfter(2);  // Inserts before the new tail.
+  list.PushTail(5);
+  i = 0;
+  for (int32_t num : list) {
+    EXPECT_EQ(num, i == 3 ? 4 : (i == 4 ? 5 : i));
+    ++i;
+  }
+  EXPECT_EQ(i, 5);
+}
+
+TEST(SinglyLinkedListTests, ReuseNodes) {
+  SinglyLinkedList<int32_t> list;
+  list.ReserveNodes(2);
+  list.PushHead(0);
+  const int32_t* node_val = &*list.begin();
+  EXPECT_EQ(list.RemoveHead(), 0);
+  EXPECT_TRUE(list.IsEmpty());
+  list.PushTail(1);
+  EXPECT_EQ(&*list.begin(), node_val);
+
+  int32_t destruct_cnt = 0;
+  {
+    SinglyLinkedList<Owned<Counter>> owned_list;
+    owned_list.EmplaceTail(Owned<Counter>::New(&destruct_cnt));
+    owned_list.EmplaceTail(Owned<Counter>::New(&destruct_cnt));
+    owned_list.Clear();
+    EXPECT_EQ(destruct_cnt, 2);
+    owned_list.EmplaceTail(Owned<Counter>::New(&destruct_cnt));
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
+
+TEST(SinglyLinkedListTests, SpliceAndReverse) {
+  SinglyLinkedList<int32_t> list = {2, 3};
+  list.SpliceFront(SinglyLinkedList<int32_t>{0, 1});
+  list.SpliceFront(SinglyLinkedList<int32_t>());
+  list.PushTail(4);
+
+  int32_t cnt = 0;
+  for (int32_t num : list) {
+    EXPECT_EQ(num, cnt);
+    ++cnt;
+  }
+  EXPECT_EQ(cnt, 5);
+
+  list.Reverse();
+  list.PushTail(-1);
+  for (int32_t num : list) {
+    --cnt;
+    EXPECT_EQ(num, cnt);
+  }
+  EXPECT_EQ(cnt, -1);
+}
+
+TEST(SinglyLinkedListTests, SortStable) {
+  struct Item {
+    int32_t key;
+    int32_t order;
+  };
+  SinglyLinkedList<Item> list;
+  for (int32_t i = 0; i < 100; ++i) {
+    list.EmplaceTail(Item{(i * 37) % 10, i});
+  }
+  const Item* first_val = &*list.begin();
+  list.Sort([](const Item& a, const Item& b) { return a.key < b.key; });
+  list.PushTail(Item{10, 100});
+
+  int32_t cnt = 0;
+  const Item* prev = nullptr;
+  for (const Item& item : list) {
+    if (prev != nullptr) {
+      EXPECT_LE(prev->key, item.key);
+      if (prev->key == item.key) {
+        EXPECT_LT(prev->order, item.order);
+      }
+    }
+    if (item.order == 0) {
+      EXPECT_EQ(&item, first_val);  // Nodes are relinked, not moved.
+    }
+    prev = &item;
+    ++cnt;
+  }
+  EXPECT_EQ(cnt, 101);
+
+  SinglyLinkedList<int32_t> nums = {3, 1, 2};
+  nums.Sort();
+  int32_t expected = 1;
+  for (int32_t num : nums) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 4);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "mirage_base/synchronize/lock.hpp"
+#include "mirage_base/synchronize/lock_profiler.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+LockProfiler::Stats FindStats(const char* name) {
+  for (const LockProfiler::Stats& stats : LockProfiler::TakeSnapshot()) {
+    if (std::strcmp(stats.name, name) == 0) {
+      return stats;
+    }
+  }
+  return {};
+}
+
+}  // namespace
+
+TEST(LockProfilerTests, Disabled) {
+  if (LockProfiler::kIsEnabled) {
+    GTEST_SKIP() << "Built with MIRAGE_LOCK_PROFILING";
+  }
+  Lock lock("LockProfilerTests.Disabled");
+  LockGuard guard(lock);
+  EXPECT_EQ(FindStats("LockProfilerTests.Disabled").acquire_cnt, 0);
+}
+
+TEST(LockProfilerTests, Record) {
+  if (!LockProfiler::kIsEnabled) {
+    GTEST_SKIP() << "Built without MIRAGE_LOCK_PROFILING";
+  }
+  Lock lock("LockProfilerTests.Record");
+  Lock same_name("LockProfilerTests.Record");
+  std::thread thread;
+  {
+    LockGuard guard(lock);
+    thread = std::thread([&lock] { LockGuard inner(lock); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    // Released while the thread waits for it.
+  }
+  thread.join();
+  EXPECT_TRUE(same_name.TryAcquire());
+  same_name.Release();
+
+  const LockProfiler::Stats stats = FindStats("LockProfilerTests.Record");
+  EXPECT_EQ(stats.line, 0);
+  EXPECT_EQ(stats.acquire_cnt, 3);
+  EXPECT_EQ(stats.contended_cnt, 1);
+  EXPECT_GT(stats.max_wait_ns, 0);
+  EXPECT_LE(stats.max_wait_ns, stats.total_wait_ns);
+  EXPECT_GE(stats.max_hold_ns, 5'000'000);
+}
+
+TEST(LockProfilerTests, CallSite) {
+  if (!LockProfiler::kIsEnabled) {
+    GTEST_SKIP() << "Built without MIRAGE_LOCK_PROFILING";
+  }
+  const Lock lock;
+  lock.Acquire();
+  lock.Release();
+  bool is_found = false;
+  for (const LockProfiler::Stats& stats : LockProfiler::TakeSnapshot()) {
+    if (std::strstr(stats.name, "lock_profiler_tests") != nullptr &&
+        stats.line != 0) {
+      EXPECT_EQ(stats.acquire_cnt, 1);
+      is_found = true;
+    }
+  }
+  EXPECT_TRUE(is_found);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/lock.hpp"
+
+using namespace mirage::base;
+
+TEST(LockTests, TryAcquire) {
+  Lock lock;
+  EXPECT_TRUE(lock.TryAcquire());
+  EXPECT_FALSE(lock.TryAcquire());
+  std::thread([&lock] { EXPECT_FALSE(lock.TryAcquire()); }).join();
+  lock.Release();
+  EXPECT_TRUE(lock.TryAcquire());
+  lock.Release();
+}
+
+TEST(LockTests, Contended) {
+  constexpr int32_t kThreadCnt = 4;
+  constexpr int32_t kIterationCnt = 20000;
+
+  Lock lock;
+  int32_t cnt = 0;
+  Array<std::thread> threads;
+  for (int32_t i = 0; i < kThreadCnt; ++i) {
+    threads.Emplace([&lock, &cnt] {
+      for (int32_t j = 0; j < kIterationCnt; ++j) {
+        LockGuard guard(lock);
+        ++cnt;
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(cnt, kThreadCnt * kIterationCnt);
+}
+
+TEST(LockTests, ParkAndWake) {
+  Lock lock;
+  lock.Acquire();
+  bool is_released = false;
+  // Outlasts the spinning, so the waiter has to park.
+  std::thread thread([&lock, &is_released] {
+    LockGuard guard(lock);
+    EXPECT_TRUE(is_released);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  is_released = true;
+  lock.Release();
+  thread.join();
+}
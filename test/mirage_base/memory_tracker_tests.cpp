@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/set.hpp"
+#include "mirage_base/container/singly_linked_list.hpp"
+#include "mirage_base/memory/memory_tracker.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Base {
+  virtual ~Base() = default;
+};
+
+struct Derived final : Base {
+  int64_t payload[4]{};
+};
+
+}  // namespace
+
+TEST(MemoryTrackerTests, TagName) {
+  EXPECT_STREQ(MemoryTracker::GetTagName(MemoryTag::kArray), "Array");
+  EXPECT_STREQ(MemoryTracker::GetTagName(MemoryTag::kCnt), "Unknown");
+}
+
+TEST(MemoryTrackerTests, TrackContainers) {
+  if (!MemoryTracker::kIsEnabled) {
+    GTEST_SKIP() << "Built without MIRAGE_MEMORY_TRACKING";
+  }
+  const MemoryTracker::Snapshot before = MemoryTracker::TakeSnapshot();
+  const auto get_live = [](const MemoryTag tag) {
+    return MemoryTracker::GetStats(tag).live_size;
+  };
+  const size_t array_live = get_live(MemoryTag::kArray);
+  const size_t tree_live = get_live(MemoryTag::kRBTree);
+  const size_t owned_live = get_live(MemoryTag::kOwned);
+  const size_t list_live = get_live(MemoryTag::kList);
+  {
+    Array<int64_t> array;
+    array.SetCapacity(100);
+    EXPECT_EQ(get_live(MemoryTag::kArray), array_live + 100 * sizeof(int64_t));
+
+    RBTree<int32_t> tree = {0, 1, 2};
+    EXPECT_GT(get_live(MemoryTag::kRBTree), tree_live);
+
+    const SinglyLinkedList<int32_t> list = {0, 1};
+    EXPECT_GT(get_live(MemoryTag::kList), list_live);
+
+    // Accounted with the size it was created with.
+    Owned<Base> owned = Owned<Derived>::New().Convert<Base>();
+    EXPECT_EQ(get_live(MemoryTag::kOwned), owned_live + sizeof(Derived));
+  }
+  EXPECT_EQ(get_live(MemoryTag::kArray), array_live);
+  EXPECT_EQ(get_live(MemoryTag::kRBTree), tree_live);
+  EXPECT_EQ(get_live(MemoryTag::kList), list_live);
+  EXPECT_EQ(get_live(MemoryTag::kOwned), owned_live);
+
+  const MemoryTracker::Snapshot after = MemoryTracker::TakeSnapshot();
+  const size_t index = static_cast<size_t>(MemoryTag::kArray);
+  EXPECT_GT(after.stats[index].alloc_cnt, before.stats[index].alloc_cnt);
+  EXPECT_GE(after.stats[index].peak_size,
+            array_live + 100 * sizeof(int64_t));
+  EXPECT_GE(after.GetAllocRate(before, MemoryTag::kArray), 0);
+}
+
+TEST(MemoryTrackerTests, PeakOfFreedBuffer) {
+  if (!MemoryTracker::kIsEnabled) {
+    GTEST_SKIP() << "Built without MIRAGE_MEMORY_TRACKING";
+  }
+  constexpr size_t kSize = 1024 * 1024;
+  const size_t live = MemoryTracker::GetStats(MemoryTag::kArray).live_size;
+  {
+    Array<int32_t> array;
+    for (size_t i = 0; i < kSize; ++i) {
+      array.Push(static_cast<int32_t>(i));
+    }
+  }
+  const MemoryTracker::Stats stats = MemoryTracker::GetStats(MemoryTag::kArray);
+  EXPECT_EQ(stats.live_size, live);
+  EXPECT_GE(stats.peak_size, live + kSize * sizeof(int32_t));
+}
+
+TEST(MemoryTrackerTests, CrossThreadFree) {
+  if (!MemoryTracker::kIsEnabled) {
+    GTEST_SKIP() << "Built without MIRAGE_MEMORY_TRACKING";
+  }
+  const size_t live = MemoryTracker::GetStats(MemoryTag::kGeneral).live_size;
+  HeapAllocator& allocator = HeapAllocator::Get();
+  void* ptr = allocator.Allocate(1000, 8);
+  std::thread thread([&] { allocator.Deallocate(ptr, 1000, 8); });
+  thread.join();
+  EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::kGeneral).live_size, live);
+}
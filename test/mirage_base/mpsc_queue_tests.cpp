@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/mpsc_queue.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(MpscQueueTests, PushAndPop) {
+  MpscQueue<int32_t> queue;
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_FALSE(queue.TryPop().IsValid());
+
+  queue.Push(0);
+  queue.Emplace(1);
+  EXPECT_FALSE(queue.IsEmpty());
+  EXPECT_EQ(queue.TryPop().Unwrap(), 0);
+  queue.Push(2);  // Lands behind the consumer side list.
+  EXPECT_EQ(queue.TryPop().Unwrap(), 1);
+  EXPECT_EQ(queue.TryPop().Unwrap(), 2);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MpscQueueTests, PopAllInOrder) {
+  MpscQueue<int32_t> queue;
+  for (int32_t i = 0; i < 4; ++i) {
+    queue.Push(i);
+  }
+  EXPECT_EQ(queue.TryPop().Unwrap(), 0);
+  for (int32_t i = 4; i < 8; ++i) {
+    queue.Push(i);
+  }
+
+  const SinglyLinkedList<int32_t> list = queue.PopAll();
+  EXPECT_TRUE(queue.IsEmpty());
+  int32_t expected = 1;
+  for (const int32_t num : list) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 8);
+}
+
+TEST(MpscQueueTests, Destruct) {
+  int32_t destruct_cnt = 0;
+  {
+    MpscQueue<Owned<Counter>> queue;
+    queue.Emplace(Owned<Counter>::New(&destruct_cnt));
+    queue.Emplace(Owned<Counter>::New(&destruct_cnt));
+    EXPECT_TRUE(queue.TryPop().IsValid());
+    queue.Emplace(Owned<Counter>::New(&destruct_cnt));
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
+
+TEST(MpscQueueTests, MultiProducer) {
+  constexpr int32_t kProducerCnt = 4;
+  constexpr int32_t kPushCnt = 10000;
+  MpscQueue<int32_t> queue;
+
+  std::thread producers[kProducerCnt];
+  for (int32_t i = 0; i < kProducerCnt; ++i) {
+    producers[i] = std::thread([&queue, i] {
+      for (int32_t j = 0; j < kPushCnt; ++j) {
+        queue.Push(i * kPushCnt + j);
+      }
+    });
+  }
+
+  // Elements of one producer keep their order.
+  int32_t last[kProducerCnt];
+  for (int32_t& num : last) {
+    num = -1;
+  }
+  int32_t pop_cnt = 0;
+  while (pop_cnt < kProducerCnt * kPushCnt) {
+    for (const int32_t num : queue.PopAll()) {
+      EXPECT_GT(num % kPushCnt, last[num / kPushCnt]);
+      last[num / kPushCnt] = num % kPushCnt;
+      ++pop_cnt;
+    }
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/container/packed_int_array.hpp"
+
+using namespace mirage::base;
+
+TEST(PackedIntArrayTests, PackValues) {
+  PackedIntArray<13> array;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    array.Push(i * 7);
+  }
+  EXPECT_EQ(array.GetSize(), 1000);
+  EXPECT_EQ(array.GetWordCnt(), (1000 * 13 + 63) / 64);
+  for (uint64_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(array.Get(i), (i * 7) & 0x1FFF);
+  }
+
+  array.Set(4, 8191);
+  EXPECT_EQ(array.Get(3), 21);
+  EXPECT_EQ(array.Get(4), 8191);
+  EXPECT_EQ(array.Get(5), 35);
+
+  array.SetSize(3);
+  array.SetSize(5);
+  EXPECT_EQ(array.Get(4), 0);
+
+  const PackedIntArray<13> copy_array(array);
+  EXPECT_EQ(copy_array.Get(2), 14);
+}
+
+TEST(PackedIntArrayTests, FullWidthValues) {
+  PackedIntArray<64> array;
+  array.Push(~uint64_t(0));
+  array.Push(1);
+  EXPECT_EQ(array.Get(0), ~uint64_t(0));
+  EXPECT_EQ(array.Get(1), 1);
+}
+
+TEST(PackedIntArrayTests, BlockPackedValues) {
+  BlockPackedArray array;
+  const uint64_t base = 1'700'000'000'000;
+  for (uint64_t i = 0; i < 1024; ++i) {
+    array.Push(base + i * 3 + i % 5);
+  }
+  EXPECT_EQ(array.GetSize(), 1024);
+  EXPECT_EQ(array.GetBlockCnt(), 8);
+  for (uint64_t i = 0; i < 1024; ++i) {
+    EXPECT_EQ(array.Get(i), base + i * 3 + i % 5);
+  }
+  EXPECT_LT(array.GetMemorySize(), 1024 * sizeof(uint64_t) / 4);
+
+  uint64_t block[BlockPackedArray::kBlockSize];
+  EXPECT_EQ(array.DecodeBlock(1, block), BlockPackedArray::kBlockSize);
+  EXPECT_EQ(block[0], array.Get(128));
+  EXPECT_EQ(block[127], array.Get(255));
+
+  // The incomplete block stays uncompressed.
+  array.Push(1);
+  array.Push(2);
+  EXPECT_EQ(array.GetBlockCnt(), 9);
+  EXPECT_EQ(array.Get(1025), 2);
+  EXPECT_EQ(array.DecodeBlock(8, block), 2);
+  EXPECT_EQ(block[0], 1);
+}
+
+TEST(PackedIntArrayTests, BlockPackedConstant) {
+  BlockPackedArray array;
+  for (int32_t i = 0; i < 256; ++i) {
+    array.Push(42);
+  }
+  EXPECT_EQ(array.Get(200), 42);
+  const BlockPackedArray move_array(std::move(array));
+  EXPECT_TRUE(array.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(move_array.Get(0), 42);
+}
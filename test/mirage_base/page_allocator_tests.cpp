@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/memory/arena.hpp"
+#include "mirage_base/memory/page_allocator.hpp"
+
+using namespace mirage::base;
+
+TEST(PageAllocatorTests, Allocate) {
+  const size_t page_size = PageAllocator::GetPageSize();
+  PageAllocator allocator({PageAllocator::HugePages::kNone, true});
+  EXPECT_EQ(allocator.GetMappedSize(1), page_size);
+  EXPECT_EQ(allocator.GetMappedSize(page_size + 1), 2 * page_size);
+
+  auto* ptr = static_cast<std::byte*>(allocator.Allocate(3 * page_size, 64));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % page_size, 0);
+  EXPECT_EQ(ptr[0], std::byte{0});
+  ptr[3 * page_size - 1] = std::byte{1};
+
+  EXPECT_TRUE(allocator.TryShrink(ptr, 3 * page_size, page_size, 64));
+  ptr[page_size - 1] = std::byte{2};
+  PageAllocator::Decommit(ptr, page_size);
+  EXPECT_EQ(ptr[page_size - 1], std::byte{0});  // Still mapped, zeroed.
+  allocator.Deallocate(ptr, page_size, 64);
+}
+
+TEST(PageAllocatorTests, HugePages) {
+  // Falls back to transparent huge pages without a reserved pool.
+  PageAllocator allocator({PageAllocator::HugePages::kExplicit, false});
+  EXPECT_EQ(allocator.GetMappedSize(1), PageAllocator::kHugePageSize);
+  auto* ptr = static_cast<int64_t*>(
+      allocator.Allocate(PageAllocator::kHugePageSize, 8));
+  ASSERT_NE(ptr, nullptr);
+  const size_t cnt = PageAllocator::kHugePageSize / sizeof(int64_t);
+  for (size_t i = 0; i < cnt; i += 512) {
+    ptr[i] = static_cast<int64_t>(i);
+  }
+  EXPECT_EQ(ptr[cnt - 512], static_cast<int64_t>(cnt - 512));
+  allocator.Deallocate(ptr, PageAllocator::kHugePageSize, 8);
+}
+
+TEST(PageAllocatorTests, Containers) {
+  PageAllocator allocator;
+  Array<int64_t> array(allocator);
+  array.SetCapacity(4096);
+  for (int64_t i = 0; i < 4096; ++i) {
+    array.Push(i);
+  }
+  const int64_t* data = array.GetRawPtr();
+  array.SetCapacity(100);  // Shrinks in place.
+  EXPECT_EQ(array.GetRawPtr(), data);
+  EXPECT_EQ(array.GetSize(), 100);
+  EXPECT_EQ(array[99], 99);
+
+  // Large heap arrays are mapped directly and shrink in place as well.
+  Array<std::byte> large;
+  large.SetCapacity(2 * HeapAllocator::kLargeSize);
+  const std::byte* large_data = large.GetRawPtr();
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large_data) %
+                PageAllocator::GetPageSize(),
+            0);
+  large.SetCapacity(HeapAllocator::kLargeSize);
+  EXPECT_EQ(large.GetRawPtr(), large_data);
+  large.SetCapacity(16);
+  EXPECT_NE(large.GetRawPtr(), large_data);
+
+  Arena arena(1024 * 1024, allocator);
+  auto* val = static_cast<int64_t*>(arena.Allocate(sizeof(int64_t), 8));
+  *val = 1;
+  EXPECT_EQ(arena.GetReservedSize(), 1024 * 1024);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/singly_linked_list.hpp"
+#include "mirage_base/memory/pool_allocator.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(PoolAllocatorTests, Allocate) {
+  using Pool = PoolAllocator<24, 8>;
+  EXPECT_EQ(Pool::kBlockSize, 24);
+  EXPECT_EQ((PoolAllocator<1, 1>::kBlockSize), sizeof(void*));
+  EXPECT_EQ((PoolAllocator<40, 32>::kBlockSize), 64);
+
+  Pool& pool = Pool::Get();
+  EXPECT_EQ(&pool, &Pool::Get());
+  void* a = pool.Allocate(24, 8);
+  void* b = pool.Allocate(16, 4);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 8, 0);
+  EXPECT_GE(pool.GetReservedSize(), Pool::kSlabSize);
+
+  pool.Deallocate(b, 16, 4);
+  EXPECT_EQ(pool.Allocate(24, 8), b);  // Last freed, first reused.
+  pool.Deallocate(a, 24, 8);
+  pool.Deallocate(b, 24, 8);
+}
+
+TEST(PoolAllocatorTests, SpillAndRefill) {
+  using Pool = PoolAllocator<32, 32>;
+  Pool& pool = Pool::Get();
+  Array<void*> ptrs;
+  for (size_t i = 0; i < 5 * Pool::kMagazineCnt; ++i) {
+    void* ptr = pool.Allocate(32, 32);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 32, 0);
+    ptrs.Push(ptr);
+  }
+  const size_t reserved = pool.GetReservedSize();
+  for (void* ptr : ptrs) {
+    pool.Deallocate(ptr, 32, 32);
+  }
+  ptrs.Clear();
+  for (size_t i = 0; i < 5 * Pool::kMagazineCnt; ++i) {
+    ptrs.Push(pool.Allocate(32, 32));
+  }
+  EXPECT_EQ(pool.GetReservedSize(), reserved);  // Spilled blocks came back.
+  for (void* ptr : ptrs) {
+    pool.Deallocate(ptr, 32, 32);
+  }
+}
+
+TEST(PoolAllocatorTests, CrossThreadFree) {
+  using Pool = PoolAllocator<48>;
+  constexpr size_t kCnt = 1000;
+  Array<void*> ptrs;
+  for (size_t i = 0; i < kCnt; ++i) {
+    ptrs.Push(Pool::Get().Allocate(48, 8));
+    *static_cast<size_t*>(ptrs[i]) = i;
+  }
+
+  std::thread thread([&ptrs] {
+    for (size_t i = 0; i < kCnt; ++i) {
+      EXPECT_EQ(*static_cast<size_t*>(ptrs[i]), i);
+      Pool::Get().Deallocate(ptrs[i], 48, 8);
+    }
+  });
+  thread.join();
+
+  // The exited thread handed its cache back to the depot.
+  const size_t reserved = Pool::Get().GetReservedSize();
+  for (size_t i = 0; i < kCnt; ++i) {
+    ptrs[i] = Pool::Get().Allocate(48, 8);
+  }
+  EXPECT_EQ(Pool::Get().GetReservedSize(), reserved);
+  for (void* ptr : ptrs) {
+    Pool::Get().Deallocate(ptr, 48, 8);
+  }
+}
+
+TEST(PoolAllocatorTests, Containers) {
+  int32_t destruct_cnt = 0;
+  {
+    auto& pool = PoolAllocatorFor<Counter>::Get();
+    auto owned = AllocatorOwned<Counter>::NewIn(pool, &destruct_cnt);
+    const Counter* ptr = owned.Get();
+    owned.Reset();
+    EXPECT_EQ(destruct_cnt, 1);
+    const AllocatorOwned<Counter> reused(
+        AllocatorOwned<Counter>::NewIn(pool, &destruct_cnt));
+    EXPECT_EQ(reused.Get(), ptr);
+  }
+  EXPECT_EQ(destruct_cnt, 2);
+
+  // Growing past a block moves the buffer to the heap.
+  using Pool = PoolAllocator<16, 8>;
+  Array<int64_t> array(Pool::Get());
+  for (int32_t i = 0; i < 100; ++i) {
+    array.Push(i);
+  }
+  for (int32_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(array[i], i);
+  }
+  void* over_aligned = Pool::Get().Allocate(8, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(over_aligned) % 64, 0);
+  Pool::Get().Deallocate(over_aligned, 8, 64);
+
+  using Node = SinglyLinkedList<int32_t>::Node;
+  SinglyLinkedList<int32_t> list(PoolAllocatorFor<Node>::Get());
+  for (int32_t i = 0; i < 100; ++i) {
+    list.PushTail(i);
+  }
+  int32_t cnt = 0;
+  for (const int32_t num : list) {
+    EXPECT_EQ(num, cnt);
+    ++cnt;
+  }
+  EXPECT_EQ(cnt, 100);
+}
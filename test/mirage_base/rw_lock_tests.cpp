@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/rw_lock.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+// Readers check that they never see a writer halfway through its update.
+template <typename T>
+void ReadWrite() {
+  constexpr int32_t kThreadCnt = 4;
+  constexpr int32_t kIterationCnt = 5000;
+
+  T lock;
+  int32_t a = 0;
+  int32_t b = 0;
+  std::atomic<int32_t> torn_cnt = 0;
+  Array<std::thread> threads;
+  for (int32_t i = 0; i < kThreadCnt; ++i) {
+    threads.Emplace([&, i] {
+      for (int32_t j = 0; j < kIterationCnt; ++j) {
+        if (i == 0 || j % 16 == 0) {
+          ExclusiveLockGuard guard(lock);
+          ++a;
+          ++b;
+        } else {
+          SharedLockGuard guard(lock);
+          if (a != b) {
+            torn_cnt.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(torn_cnt.load(), 0);
+  EXPECT_EQ(a, kIterationCnt + (kThreadCnt - 1) * (kIterationCnt / 16 + 1));
+  EXPECT_EQ(a, b);
+}
+
+}  // namespace
+
+TEST(RWLockTests, TryAcquire) {
+  RWLock lock;
+  EXPECT_TRUE(lock.TryAcquireShared());
+  EXPECT_TRUE(lock.TryAcquireShared());
+  EXPECT_FALSE(lock.TryAcquireExclusive());
+  lock.ReleaseShared();
+  lock.ReleaseShared();
+  EXPECT_TRUE(lock.TryAcquireExclusive());
+  EXPECT_FALSE(lock.TryAcquireShared());
+  lock.ReleaseExclusive();
+}
+
+TEST(RWLockTests, WriterPreferred) {
+  RWLock lock;
+  lock.AcquireShared();
+  std::atomic<bool> is_written = false;
+  std::thread writer([&lock, &is_written] {
+    ExclusiveLockGuard guard(lock);
+    is_written = true;
+  });
+  // Once the writer waits, readers queue up behind it.
+  while (lock.TryAcquireShared()) {
+    lock.ReleaseShared();
+    std::this_thread::yield();
+  }
+  EXPECT_FALSE(is_written);
+  std::thread reader([&lock, &is_written] {
+    SharedLockGuard guard(lock);
+    EXPECT_TRUE(is_written);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  lock.ReleaseShared();
+  writer.join();
+  reader.join();
+}
+
+TEST(RWLockTests, ReadWrite) { ReadWrite<RWLock>(); }
+
+TEST(RWLockTests, BigReaderReadWrite) { ReadWrite<BigReaderLock>(); }
+
+TEST(RWLockTests, BigReaderBlocksWriter) {
+  BigReaderLock lock;
+  lock.AcquireShared();
+  lock.AcquireShared();  // Two readers counted in one slot.
+  std::atomic<bool> is_written = false;
+  std::thread writer([&lock, &is_written] {
+    ExclusiveLockGuard guard(lock);
+    is_written = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(is_written);
+  lock.ReleaseShared();
+  lock.ReleaseShared();
+  writer.join();
+  EXPECT_TRUE(is_written);
+}
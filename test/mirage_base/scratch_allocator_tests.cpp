@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/memory/scratch_allocator.hpp"
+
+using namespace mirage::base;
+
+TEST(ScratchAllocatorTests, ScopeRewinds) {
+  Arena& scratch = ScratchAllocator::Get();
+  const size_t used = scratch.GetUsedSize();
+  {
+    const ScratchScope scope;
+    Array<int32_t> array = scope.NewArray<int32_t>(16);
+    EXPECT_EQ(&array.GetAllocator(), &scratch);
+    for (int32_t i = 0; i < 1000; ++i) {
+      array.Push(i);
+    }
+    EXPECT_EQ(array[999], 999);
+    {
+      const ScratchScope inner;
+      Array<int32_t> nested = inner.NewArray<int32_t>(8);
+      nested.Push(1);
+      EXPECT_GT(scratch.GetUsedSize(), used);
+    }
+    EXPECT_EQ(array[0], 0);  // Inner scopes leave outer buffers alone.
+  }
+  EXPECT_EQ(scratch.GetUsedSize(), used);
+
+  // Chunks are kept, later scopes do not reserve more.
+  const size_t reserved = scratch.GetReservedSize();
+  {
+    const ScratchScope scope;
+    Array<int32_t> array = scope.NewArray<int32_t>(1000);
+  }
+  EXPECT_EQ(scratch.GetReservedSize(), reserved);
+}
+
+TEST(ScratchAllocatorTests, LatestBlockIsReturned) {
+  const ScratchScope scope;
+  Arena& scratch = ScratchAllocator::Get();
+  const size_t used = scratch.GetUsedSize();
+  void* ptr = scratch.Allocate(64, 8);
+  EXPECT_TRUE(scratch.TryShrink(ptr, 64, 16, 8));
+  EXPECT_EQ(scratch.GetUsedSize(), used + 16);
+  scratch.Deallocate(ptr, 16, 8);
+  EXPECT_EQ(scratch.GetUsedSize(), used);
+
+  void* a = scratch.Allocate(8, 8);
+  void* b = scratch.Allocate(8, 8);
+  EXPECT_FALSE(scratch.TryShrink(a, 8, 4, 8));
+  scratch.Deallocate(a, 8, 8);  // Not the latest, kept until the scope ends.
+  EXPECT_EQ(scratch.Allocate(8, 8), static_cast<std::byte*>(b) + 8);
+}
+
+TEST(ScratchAllocatorTests, TopArrayGrowsInPlace) {
+  const ScratchScope scope;
+  Arena& scratch = ScratchAllocator::Get();
+  const size_t used = scratch.GetUsedSize();
+  Array<int32_t> array = scope.NewArray<int32_t>(16);
+  const int32_t* data = array.GetRawPtr();
+  array.SetCapacity(256);
+  EXPECT_EQ(array.GetRawPtr(), data);
+  EXPECT_EQ(scratch.GetUsedSize(), used + 256 * sizeof(int32_t));
+
+  // Once another block sits on top, growing has to move.
+  void* top = scratch.Allocate(8, 8);
+  array.SetCapacity(512);
+  EXPECT_NE(array.GetRawPtr(), data);
+  EXPECT_NE(array.GetRawPtr(), top);
+}
+
+TEST(ScratchAllocatorTests, PerThread) {
+  Arena* main_scratch = &ScratchAllocator::Get();
+  Arena* thread_scratch = nullptr;
+  std::thread thread([&thread_scratch] {
+    thread_scratch = &ScratchAllocator::Get();
+    {
+      const ScratchScope scope;
+      Array<int32_t> array = scope.NewArray<int32_t>();
+      for (int32_t i = 0; i < 100; ++i) {
+        array.Push(i);
+      }
+    }
+    EXPECT_EQ(ScratchAllocator::Get().GetUsedSize(), 0);
+  });
+  thread.join();
+  EXPECT_NE(thread_scratch, main_scratch);
+}
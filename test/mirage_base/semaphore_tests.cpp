@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/semaphore.hpp"
+
+using namespace mirage::base;
+
+TEST(SemaphoreTests, Count) {
+  Semaphore semaphore(2);
+  EXPECT_TRUE(semaphore.TryAcquire());
+  semaphore.Acquire();
+  EXPECT_FALSE(semaphore.TryAcquire());
+  EXPECT_FALSE(semaphore.AcquireFor(std::chrono::milliseconds(1)));
+  semaphore.Release(2);
+  EXPECT_EQ(semaphore.GetCnt(), 2);
+}
+
+TEST(SemaphoreTests, LimitsConcurrency) {
+  constexpr int32_t kThreadCnt = 6;
+  constexpr int32_t kPermitCnt = 2;
+
+  Semaphore semaphore(kPermitCnt);
+  std::atomic<int32_t> active_cnt = 0;
+  std::atomic<int32_t> max_active_cnt = 0;
+  Array<std::thread> threads;
+  for (int32_t i = 0; i < kThreadCnt; ++i) {
+    threads.Emplace([&] {
+      for (int32_t j = 0; j < 200; ++j) {
+        semaphore.Acquire();
+        const int32_t cnt = active_cnt.fetch_add(1) + 1;
+        int32_t max_cnt = max_active_cnt.load();
+        while (cnt > max_cnt &&
+               !max_active_cnt.compare_exchange_weak(max_cnt, cnt)) {
+        }
+        std::this_thread::yield();
+        active_cnt.fetch_sub(1);
+        semaphore.Release();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(max_active_cnt.load(), kPermitCnt);
+  EXPECT_EQ(semaphore.GetCnt(), kPermitCnt);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/seq_lock.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+// Spans several words, so a torn read shows up as fields that differ.
+struct Snapshot {
+  int64_t a{0};
+  int64_t b{0};
+  int64_t c{0};
+  int32_t d{0};
+};
+
+}  // namespace
+
+TEST(SeqLockTests, LoadStore) {
+  SeqLock<Snapshot> lock;
+  EXPECT_EQ(lock.Load().a, 0);
+  lock.Store({1, 2, 3, 4});
+  const Snapshot snapshot = lock.Load();
+  EXPECT_EQ(snapshot.a, 1);
+  EXPECT_EQ(snapshot.b, 2);
+  EXPECT_EQ(snapshot.c, 3);
+  EXPECT_EQ(snapshot.d, 4);
+
+  Snapshot copy;
+  EXPECT_TRUE(lock.TryLoad(copy));
+  EXPECT_EQ(copy.d, 4);
+
+  SeqLock<int32_t> value(7);
+  value.Update([](int32_t& val) { val *= 2; });
+  EXPECT_EQ(value.Load(), 14);
+}
+
+// Readers never see a value halfway through a write, and never see values
+// go back in time.
+TEST(SeqLockTests, ConcurrentReadWrite) {
+  constexpr int32_t kReaderCnt = 3;
+  constexpr int32_t kWriterCnt = 2;
+  constexpr int32_t kIterationCnt = 5000;
+
+  SeqLock<Snapshot> lock;
+  std::atomic<int32_t> torn_cnt = 0;
+  std::atomic<int32_t> reordered_cnt = 0;
+  std::atomic<bool> is_done = false;
+  Array<std::thread> readers;
+  for (int32_t i = 0; i < kReaderCnt; ++i) {
+    readers.Emplace([&] {
+      int64_t last = 0;
+      while (!is_done.load(std::memory_order_relaxed)) {
+        const Snapshot snapshot = lock.Load();
+        if (snapshot.b != snapshot.a * 2 || snapshot.c != snapshot.a * 3 ||
+            snapshot.d != static_cast<int32_t>(snapshot.a)) {
+          torn_cnt.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (snapshot.a < last) {
+          reordered_cnt.fetch_add(1, std::memory_order_relaxed);
+        }
+        last = snapshot.a;
+      }
+    });
+  }
+  Array<std::thread> writers;
+  for (int32_t i = 0; i < kWriterCnt; ++i) {
+    writers.Emplace([&] {
+      for (int32_t j = 0; j < kIterationCnt; ++j) {
+        lock.Update([](Snapshot& snapshot) {
+          ++snapshot.a;
+          snapshot.b = snapshot.a * 2;
+          snapshot.c = snapshot.a * 3;
+          snapshot.d = static_cast<int32_t>(snapshot.a);
+        });
+      }
+    });
+  }
+  for (std::thread& writer : writers) {
+    writer.join();
+  }
+  is_done.store(true, std::memory_order_relaxed);
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(torn_cnt.load(), 0);
+  EXPECT_EQ(reordered_cnt.load(), 0);
+  EXPECT_EQ(lock.Load().a, kWriterCnt * kIterationCnt);
+}
+
+// A value loaded from the lock publishes plain memory written before its
+// `Store`, which TSAN would report as a race otherwise.
+TEST(SeqLockTests, Publish) {
+  constexpr int32_t kSlotCnt = 64;
+
+  int32_t slots[kSlotCnt]{};
+  SeqLock<int32_t> published(-1);
+  std::thread writer([&] {
+    for (int32_t i = 0; i < kSlotCnt; ++i) {
+      slots[i] = i + 1;
+      published.Store(i);
+    }
+  });
+  int32_t index = -1;
+  while (index != kSlotCnt - 1) {
+    index = published.Load();
+    for (int32_t i = 0; i <= index; ++i) {
+      EXPECT_EQ(slots[i], i + 1);
+    }
+  }
+  writer.join();
+}
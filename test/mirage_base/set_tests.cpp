@@ -1,6 +1,9 @@
 ﻿#include <gtest/gtest.h>
 
+#include <cstdlib>
+
 #include "mirage_base/container/set.hpp"
+#include "mirage_base/memory/scratch_allocator.hpp"
 
 using namespace mirage::base;
 
@@ -72,3 +75,23 @@ TEST(SetTests, RemoveBoundary) {
   EXPECT_EQ(removed, 0);
   EXPECT_FALSE(remove_again.IsValid());
 }
+
+// Static sets are cleared after the thread locals of the main thread, like
+// its scratch allocator, are destructed.
+TEST(SetTests, ClearAtExit) {
+  // Runs in a fresh process, so memory held by earlier tests is not reported.
+  GTEST_FLAG_SET(death_test_style, "threadsafe");
+  EXPECT_EXIT(
+      {
+        {
+          const ScratchScope scope;
+          Array<int32_t> array = scope.NewArray<int32_t>(1);
+        }
+        static Set<int32_t> set;
+        for (int32_t i = 0; i < 10; ++i) {
+          set.Insert(int32_t(i));
+        }
+        std::exit(0);
+      },
+      testing::ExitedWithCode(0), "");
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/soa_array.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(SoAArrayTests, Construct) {
+  SoAArray<int32_t, float> array;
+  EXPECT_TRUE(array.IsEmpty());
+  array.Push(0, 0.5f);
+  array.Emplace(1, 1.5f);
+  array.Emplace(2, 2.5f);
+  EXPECT_EQ(array.GetSize(), 3);
+
+  const SoAArray<int32_t, float> copy_array(array);
+  EXPECT_EQ(copy_array.GetSize(), 3);
+  EXPECT_EQ(copy_array.Get<0>(2), 2);
+  EXPECT_EQ(copy_array.Get<1>(2), 2.5f);
+
+  int32_t* raw_ptr = array.GetRawPtr<0>();
+  const SoAArray<int32_t, float> move_array(std::move(array));
+  EXPECT_TRUE(array.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(array.GetRawPtr<0>(), nullptr);
+  EXPECT_EQ(raw_ptr, move_array.GetRawPtr<0>());
+}
+
+TEST(SoAArrayTests, FieldsAreAligned) {
+  SoAArray<char, int32_t, double> array;
+  array.Emplace('a', 1, 1.0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.GetRawPtr<0>()) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.GetRawPtr<1>()) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.GetRawPtr<2>()) % 64, 0);
+}
+
+TEST(SoAArrayTests, AccessSpanAndRow) {
+  SoAArray<int32_t, float> array;
+  for (int32_t i = 0; i < 10; ++i) {
+    array.Emplace(i, static_cast<float>(i));
+  }
+
+  for (int32_t& num : array.GetSpan<0>()) {
+    num *= 2;
+  }
+  const auto& const_array = array;
+  const ConstSpan<float> floats = const_array.GetSpan<1>();
+  EXPECT_EQ(floats.GetSize(), 10);
+  EXPECT_EQ(floats[9], 9.0f);
+
+  auto row = array[3];
+  EXPECT_EQ(row.GetIndex(), 3);
+  EXPECT_EQ(row.Get<0>(), 6);
+  row.Get<1>() = 0.25f;
+  EXPECT_EQ(array.Get<1>(3), 0.25f);
+}
+
+TEST(SoAArrayTests, ChangeSizeAndCapacity) {
+  SoAArray<int32_t, float> array;
+  array.SetSize(3);
+  EXPECT_EQ(array.GetSize(), 3);
+  EXPECT_EQ(array.GetCapacity(), 3);
+  EXPECT_EQ(array.Get<0>(2), 0);
+
+  array.Emplace(3, 3.0f);
+  EXPECT_EQ(array.GetSize(), 4);
+  EXPECT_EQ(array.GetCapacity(), 6);
+  EXPECT_EQ(array.Get<0>(3), 3);
+
+  array.SetCapacity(2);
+  EXPECT_EQ(array.GetSize(), 2);
+  EXPECT_EQ(array.GetCapacity(), 2);
+}
+
+TEST(SoAArrayTests, DestructFields) {
+  int32_t destruct_cnt = 0;
+  {
+    SoAArray<Owned<Counter>, int32_t> array;
+    array.Emplace(Owned<Counter>::New(&destruct_cnt), 0);
+    array.Emplace(Owned<Counter>::New(&destruct_cnt), 1);
+    array.Emplace(Owned<Counter>::New(&destruct_cnt), 2);
+    EXPECT_EQ(destruct_cnt, 0);
+    array.SetSize(2);
+    EXPECT_EQ(destruct_cnt, 1);
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/memory/memory_tracker.hpp"
+#include "mirage_base/util/sort.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Event {
+  int32_t time;
+  int32_t id;
+
+  bool operator<(const Event& other) const { return time < other.time; }
+};
+
+template <typename T>
+bool IsSorted(const Array<T>& array) {
+  return std::is_sorted(array.begin(), array.end());
+}
+
+Array<int32_t> RandomArray(const size_t size, const int32_t range) {
+  std::mt19937 gen(static_cast<uint32_t>(size));
+  std::uniform_int_distribution<int32_t> dist(-range, range);
+  Array<int32_t> array;
+  array.Reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    array.Push(dist(gen));
+  }
+  return array;
+}
+
+}  // namespace
+
+TEST(SortTests, SortRandom) {
+  for (const size_t size : {0, 1, 2, 7, 23, 24, 100, 511, 512, 5000}) {
+    Array<int32_t> array = RandomArray(size, 1000);
+    Array<int32_t> expected = array;
+    std::sort(expected.begin(), expected.end());
+    Sort(array);
+    EXPECT_EQ(array, expected);
+  }
+}
+
+// Every size below the insertion sort threshold has a network of its own.
+TEST(SortTests, SortSmall) {
+  for (size_t size = 0; size <= 24; ++size) {
+    for (const int32_t range : {2, 1000}) {
+      Array<int32_t> array = RandomArray(size, range);
+      Array<int32_t> expected = array;
+      std::sort(expected.begin(), expected.end());
+      Sort(array);
+      EXPECT_EQ(array, expected);
+    }
+  }
+}
+
+TEST(SortTests, SortPatterns) {
+  const size_t size = 2000;
+  Array<int32_t> ascending;
+  Array<int32_t> descending;
+  Array<int32_t> equal;
+  Array<int32_t> sawtooth;
+  for (size_t i = 0; i < size; ++i) {
+    const auto num = static_cast<int32_t>(i);
+    ascending.Push(num);
+    descending.Push(-num);
+    equal.Push(7);
+    sawtooth.Push(num % 37);
+  }
+  for (Array<int32_t>* array : {&ascending, &descending, &equal, &sawtooth}) {
+    // Use a custom order to keep it on the comparison based path.
+    Sort(*array, [](int32_t a, int32_t b) { return a < b; });
+    EXPECT_TRUE(IsSorted(*array));
+    EXPECT_EQ(array->GetSize(), size);
+  }
+}
+
+TEST(SortTests, SortNonArithmetic) {
+  Array<Event> events;
+  const Array<int32_t> times = RandomArray(1000, 50);
+  for (size_t i = 0; i < times.GetSize(); ++i) {
+    events.Push({times[i], static_cast<int32_t>(i)});
+  }
+
+  Array<Event> stable = events;
+  Sort(events);
+  EXPECT_TRUE(IsSorted(events));
+
+  StableSort(stable);
+  EXPECT_TRUE(IsSorted(stable));
+  for (size_t i = 1; i < stable.GetSize(); ++i) {
+    if (stable[i - 1].time == stable[i].time) {
+      EXPECT_LT(stable[i - 1].id, stable[i].id);
+    }
+  }
+}
+
+TEST(SortTests, RadixSortKeys) {
+  Array<float> floats;
+  Array<int64_t> ints;
+  std::mt19937 gen(13);
+  std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+  for (int32_t i = 0; i < 1000; ++i) {
+    floats.Push(dist(gen));
+    ints.Push(static_cast<int64_t>(dist(gen) * 1e12f));
+  }
+  floats.Push(-0.0f);
+  floats.Push(0.0f);
+  Sort(floats);
+  Sort(ints);
+  EXPECT_TRUE(IsSorted(floats));
+  EXPECT_TRUE(IsSorted(ints));
+
+  Array<Event> events;
+  const Array<int32_t> times = RandomArray(1000, 50);
+  for (size_t i = 0; i < times.GetSize(); ++i) {
+    events.Push({times[i], static_cast<int32_t>(i)});
+  }
+  RadixSortByKey(events, [](const Event& event) { return event.time; });
+  EXPECT_TRUE(IsSorted(events));
+  for (size_t i = 1; i < events.GetSize(); ++i) {
+    if (events[i - 1].time == events[i].time) {
+      EXPECT_LT(events[i - 1].id, events[i].id);
+    }
+  }
+}
+
+// Scratch buffers are tracked and released even when the key throws.
+TEST(SortTests, ScratchIsReleased) {
+  Array<Event> events;
+  const Array<int32_t> times = RandomArray(1000, 50);
+  for (size_t i = 0; i < times.GetSize(); ++i) {
+    events.Push({times[i], static_cast<int32_t>(i)});
+  }
+  const MemoryTracker::Stats before =
+      MemoryTracker::GetStats(MemoryTag::kArray);
+
+  size_t key_cnt = 0;
+  EXPECT_THROW(RadixSortByKey(events,
+                              [&key_cnt](const Event& event) {
+                                // Throws in the scatter pass.
+                                if (++key_cnt == 1500) {
+                                  throw std::runtime_error("key");
+                                }
+                                return event.time;
+                              }),
+               std::runtime_error);
+  StableSort(events);
+  EXPECT_TRUE(IsSorted(events));
+
+  const MemoryTracker::Stats after = MemoryTracker::GetStats(MemoryTag::kArray);
+  EXPECT_EQ(after.live_size, before.live_size);
+  if (MemoryTracker::kIsEnabled) {
+    // Histograms and buffer of the radix sort, buffer of the merge sort.
+    EXPECT_EQ(after.alloc_cnt, before.alloc_cnt + 3);
+  }
+}
+
+TEST(SortTests, SelectElements) {
+  Array<int32_t> array = RandomArray(3000, 100000);
+  Array<int32_t> expected = array;
+  std::sort(expected.begin(), expected.end());
+
+  NthElement(array, 1234);
+  EXPECT_EQ(array[1234], expected[1234]);
+  for (size_t i = 0; i < 1234; ++i) {
+    EXPECT_LE(array[i], array[1234]);
+  }
+
+  PartialSort(array, 100);
+  for (size_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(array[i], expected[i]);
+  }
+}
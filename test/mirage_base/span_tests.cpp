@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/container/span.hpp"
+
+using namespace mirage::base;
+
+TEST(SpanTests, Construct) {
+  const Span<int32_t> empty_span;
+  EXPECT_TRUE(empty_span.IsEmpty());
+  EXPECT_EQ(empty_span.GetRawPtr(), nullptr);
+
+  Array<int32_t> array = {0, 1, 2, 3};
+  const Span<int32_t> span = array;
+  EXPECT_EQ(span.GetSize(), 4);
+  EXPECT_EQ(span.GetRawPtr(), array.GetRawPtr());
+  span[1] = 10;
+  EXPECT_EQ(array[1], 10);
+
+  const ConstSpan<int32_t> const_span = span;
+  EXPECT_EQ(const_span.GetSize(), 4);
+  EXPECT_EQ(const_span[1], 10);
+
+  int32_t raw[3] = {4, 5, 6};
+  const Span<int32_t, 3> static_span = raw;
+  EXPECT_EQ(static_span.GetSize(), 3);
+  EXPECT_EQ(sizeof(static_span), sizeof(int32_t*));
+  const ConstSpan<int32_t> dynamic_span = static_span;
+  EXPECT_EQ(dynamic_span.GetSize(), 3);
+  EXPECT_EQ(dynamic_span[2], 6);
+}
+
+TEST(SpanTests, Slice) {
+  const Array<int32_t> array = {0, 1, 2, 3, 4, 5};
+  const ConstSpan<int32_t> span = array;
+
+  const ConstSpan<int32_t> first = span.First(2);
+  EXPECT_EQ(first.GetSize(), 2);
+  EXPECT_EQ(first[1], 1);
+  const ConstSpan<int32_t> last = span.Last(2);
+  EXPECT_EQ(last.GetSize(), 2);
+  EXPECT_EQ(last[0], 4);
+
+  const ConstSpan<int32_t> sub = span.Subspan(1, 3);
+  EXPECT_EQ(sub.GetSize(), 3);
+  EXPECT_EQ(sub[0], 1);
+  EXPECT_EQ(span.Subspan(4).GetSize(), 2);
+  EXPECT_TRUE(span.Subspan(6).IsEmpty());
+
+  const Span<const int32_t, 3> static_first = span.First<3>();
+  EXPECT_EQ(static_first[2], 2);
+  const Span<const int32_t, 1> static_last = span.Last<1>();
+  EXPECT_EQ(static_last[0], 5);
+}
+
+TEST(SpanTests, Chunk) {
+  Array<int32_t> array;
+  for (int32_t i = 0; i < 10; ++i) {
+    array.Emplace(i);
+  }
+  const Span<int32_t> span = array;
+  EXPECT_EQ(span.GetChunkCnt(4), 3);
+  EXPECT_EQ(span.GetChunk(4, 0).GetSize(), 4);
+  EXPECT_EQ(span.GetChunk(4, 2).GetSize(), 2);
+  EXPECT_EQ(span.GetChunk(4, 2)[0], 8);
+  EXPECT_EQ(span.GetChunkCnt(5), 2);
+  EXPECT_EQ(Span<int32_t>().GetChunkCnt(4), 0);
+
+  int32_t sum = 0;
+  for (size_t i = 0; i < span.GetChunkCnt(3); ++i) {
+    for (const int32_t num : span.GetChunk(3, i)) {
+      sum += num;
+    }
+  }
+  EXPECT_EQ(sum, 45);
+}
+
+TEST(SpanTests, Bytes) {
+  uint32_t raw[2] = {0x01020304, 0x05060708};
+  const Span<uint32_t> span = raw;
+  const ConstSpan<std::byte> bytes = span.AsBytes();
+  EXPECT_EQ(bytes.GetSize(), 8);
+  EXPECT_EQ(span.GetSizeBytes(), 8);
+
+  const Span<std::byte> writable = span.AsWritableBytes();
+  for (std::byte& byte : writable) {
+    byte = std::byte{0};
+  }
+  EXPECT_EQ(raw[0], 0);
+  EXPECT_EQ(raw[1], 0);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "mirage_base/string/atom.hpp"
+#include "mirage_base/string/string.hpp"
+
+using namespace mirage::base;
+
+TEST(StringTests, Construct) {
+  EXPECT_TRUE(HashKeyType<String>);
+
+  const String empty;
+  EXPECT_TRUE(empty.IsEmpty());
+  EXPECT_STREQ(empty.GetCStr(), "");
+
+  const String inline_str = "twenty two bytes long!";
+  EXPECT_EQ(inline_str.GetSize(), String::kInlineCapacity);
+  EXPECT_TRUE(inline_str.IsInline());
+  const String heap_str = "twenty three bytes long";
+  EXPECT_FALSE(heap_str.IsInline());
+  EXPECT_STREQ(heap_str.GetCStr(), "twenty three bytes long");
+  EXPECT_EQ(heap_str[22], 'g');
+
+  String copy_str(heap_str);
+  EXPECT_EQ(copy_str, heap_str);
+  EXPECT_NE(copy_str.GetCStr(), heap_str.GetCStr());
+  const String move_str(std::move(copy_str));
+  EXPECT_TRUE(copy_str.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(move_str, heap_str);
+
+  String assign_str;
+  assign_str = inline_str;
+  EXPECT_EQ(assign_str, inline_str);
+  assign_str = move_str;
+  EXPECT_EQ(assign_str.AsSpan().GetSize(), 23);
+}
+
+TEST(StringTests, Append) {
+  String str = "abc";
+  str.Append("def", 3);
+  EXPECT_STREQ(str.GetCStr(), "abcdef");
+  const size_t hash = str.GetHash();
+
+  // Grows past the inline storage, then within the heap buffer.
+  for (int32_t i = 0; i < 10; ++i) {
+    str.Append(str);
+  }
+  EXPECT_EQ(str.GetSize(), 6 * 1024);
+  EXPECT_FALSE(str.IsInline());
+  EXPECT_EQ(std::strncmp(str.GetCStr() + 6 * 1023, "abcdef", 7), 0);
+  EXPECT_NE(str.GetHash(), hash);
+
+  str.Clear();
+  EXPECT_TRUE(str.IsInline());
+  str.Append("abcdef", 6);
+  EXPECT_EQ(str.GetHash(), hash);
+  EXPECT_EQ(Hash<String>()(str), hash);
+}
+
+TEST(StringTests, Compare) {
+  const String a = "identifier_a";
+  const String b = "identifier_b";
+  EXPECT_NE(a, b);
+  EXPECT_NE(a.GetHash(), b.GetHash());
+  EXPECT_EQ(a, String("identifier_a"));
+  EXPECT_NE(a, String("identifier"));
+  EXPECT_EQ(String("a\0b", 3).GetSize(), 3);
+  EXPECT_NE(String("a\0b", 3), String("a\0c", 3));
+}
+
+TEST(StringTests, Atom) {
+  EXPECT_TRUE(HashKeyType<Atom>);
+
+  const Atom a("texture");
+  const Atom b(String("texture"));
+  const Atom c("mesh");
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(&a.GetString(), &b.GetString());
+  EXPECT_NE(a, c);
+  EXPECT_STREQ(c.GetCStr(), "mesh");
+  EXPECT_EQ(a.GetHash(), String("texture").GetHash());
+  EXPECT_EQ(Atom(), Atom(""));
+  EXPECT_TRUE(Atom().GetString().IsEmpty());
+
+  // Grows the table while other threads intern the same strings.
+  const size_t interned_cnt = Atom::GetInternedCnt();
+  auto intern = [] {
+    for (int32_t i = 0; i < 1000; ++i) {
+      String str = "atom_";
+      const std::string num = std::to_string(i);
+      str.Append(num.c_str(), num.size());
+      EXPECT_EQ(Atom(str).GetString(), str);
+    }
+  };
+  std::thread thread(intern);
+  intern();
+  thread.join();
+  EXPECT_EQ(Atom::GetInternedCnt(), interned_cnt + 1000);
+  EXPECT_EQ(Atom("atom_999"), Atom(String("atom_999")));
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/treiber_stack.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(TreiberStackTests, PushAndPop) {
+  TreiberStack<int32_t> stack;
+  EXPECT_TRUE(stack.IsEmpty());
+  EXPECT_FALSE(stack.TryPop().IsValid());
+
+  stack.Push(0);
+  stack.Emplace(1);
+  EXPECT_EQ(stack.TryPop().Unwrap(), 1);
+  stack.Push(2);  // Reuses the popped node.
+  EXPECT_EQ(stack.TryPop().Unwrap(), 2);
+  EXPECT_EQ(stack.TryPop().Unwrap(), 0);
+  EXPECT_TRUE(stack.IsEmpty());
+
+  for (int32_t i = 0; i < 4; ++i) {
+    stack.Push(i);
+  }
+  int32_t expected = 3;
+  for (const int32_t num : stack.PopAll()) {
+    EXPECT_EQ(num, expected);
+    --expected;
+  }
+  EXPECT_EQ(expected, -1);
+  EXPECT_TRUE(stack.IsEmpty());
+}
+
+TEST(TreiberStackTests, Destruct) {
+  int32_t destruct_cnt = 0;
+  {
+    TreiberStack<Owned<Counter>> stack;
+    stack.Emplace(Owned<Counter>::New(&destruct_cnt));
+    stack.Emplace(Owned<Counter>::New(&destruct_cnt));
+    EXPECT_TRUE(stack.TryPop().IsValid());
+    stack.Emplace(Owned<Counter>::New(&destruct_cnt));
+    EXPECT_EQ(destruct_cnt, 1);
+  }
+  EXPECT_EQ(destruct_cnt, 3);
+}
+
+TEST(TreiberStackTests, MultiThread) {
+  constexpr int32_t kThreadCnt = 4;
+  constexpr int32_t kPushCnt = 10000;
+  TreiberStack<int32_t> stack;
+  std::atomic<int64_t> pop_sum{0};
+
+  std::thread threads[kThreadCnt];
+  for (std::thread& thread : threads) {
+    thread = std::thread([&stack, &pop_sum] {
+      for (int32_t i = 0; i < kPushCnt; ++i) {
+        stack.Push(i);
+        Optional<int32_t> val = stack.TryPop();
+        if (val.IsValid()) {
+          pop_sum.fetch_add(val.Unwrap(), std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  int64_t sum = pop_sum.load();
+  for (const int32_t num : stack.PopAll()) {
+    sum += num;
+  }
+  EXPECT_EQ(sum, int64_t{kThreadCnt} * kPushCnt * (kPushCnt - 1) / 2);
+}
+
+// Batches taken by `PopAll` are recycled while other threads still pop.
+TEST(TreiberStackTests, PopAllWhilePopping) {
+  constexpr int32_t kThreadCnt = 4;
+  constexpr int32_t kPushCnt = 10000;
+  TreiberStack<int32_t> stack;
+  std::atomic<int64_t> pop_sum{0};
+
+  std::thread threads[kThreadCnt];
+  for (int32_t i = 0; i < kThreadCnt; ++i) {
+    threads[i] = std::thread([&stack, &pop_sum, i] {
+      for (int32_t j = 0; j < kPushCnt; ++j) {
+        stack.Push(j);
+        if (i == 0 && j % 8 == 0) {
+          for (const int32_t num : stack.PopAll()) {
+            pop_sum.fetch_add(num, std::memory_order_relaxed);
+          }
+          continue;
+        }
+        Optional<int32_t> val = stack.TryPop();
+        if (val.IsValid()) {
+          pop_sum.fetch_add(val.Unwrap(), std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  int64_t sum = pop_sum.load();
+  for (const int32_t num : stack.PopAll()) {
+    sum += num;
+  }
+  EXPECT_EQ(sum, int64_t{kThreadCnt} * kPushCnt * (kPushCnt - 1) / 2);
+}
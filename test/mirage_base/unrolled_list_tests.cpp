@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "mirage_base/auto_ptr/owned.hpp"
+#include "mirage_base/container/unrolled_list.hpp"
+
+using namespace mirage::base;
+
+namespace {
+
+struct Counter final {
+  int32_t* base_destructed{nullptr};
+
+  explicit Counter(int32_t* base_destructed)
+      : base_destructed(base_destructed) {}
+
+  ~Counter() { *base_destructed += 1; }
+};
+
+}  // namespace
+
+TEST(UnrolledListTests, Construct) {
+  EXPECT_TRUE(std::forward_iterator<UnrolledList<int32_t>::Iterator>);
+  EXPECT_TRUE(std::forward_iterator<UnrolledList<int32_t>::ConstIterator>);
+
+  UnrolledList<int32_t, 4> list = {0, 1, 2, 3, 4};
+  EXPECT_EQ(list.GetSize(), 5);
+  EXPECT_EQ(list.GetNodeCnt(), 2);  // Appending fills nodes completely.
+  EXPECT_EQ(list.GetFront(), 0);
+  EXPECT_EQ(list.GetBack(), 4);
+
+  const UnrolledList<int32_t, 4> copy_list(list);
+  int32_t expected = 0;
+  for (const int32_t num : copy_list) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 5);
+
+  const UnrolledList<int32_t, 4> move_list(std::move(list));
+  EXPECT_TRUE(list.IsEmpty());  // NOLINT(*-use-after-move): Allow for test.
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_EQ(move_list.GetSize(), 5);
+}
+
+TEST(UnrolledListTests, InsertSplitsNode) {
+  UnrolledList<int32_t, 4> list = {0, 1, 3, 4};
+  EXPECT_EQ(list.GetNodeCnt(), 1);
+
+  auto iter = list.begin();
+  ++iter;
+  ++iter;
+  iter = list.Insert(iter, 2);
+  EXPECT_EQ(*iter, 2);
+  EXPECT_EQ(list.GetNodeCnt(), 2);
+  list.PushFront(-1);
+  list.PushBack(5);
+
+  int32_t expected = -1;
+  for (const int32_t num : list) {
+    EXPECT_EQ(num, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 6);
+  EXPECT_EQ(list.GetSize(), 7);
+}
+
+TEST(UnrolledListTests, RemoveMergesNodes) {
+  UnrolledList<int32_t, 4> list;
+  for (int32_t i = 0; i < 12; ++i) {
+    list.PushBack(i);
+  }
+  EXPECT_EQ(list.GetNodeCnt(), 3);
+
+  // Remove every odd number.
+  auto iter = list.begin();
+  while (iter != list.end()) {
+    if (*iter % 2 == 1) {
+      iter = list.Remove(iter);
+    } else {
+      ++iter;
+    }
+  }
+  EXPECT_EQ(list.GetSize(), 6);
+  EXPECT_EQ(list.GetNodeCnt(), 3);
+  int32_t expected = 0;
+  for (const int32_t num : list) {
+    EXPECT_EQ(num, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, 12);
+
+  // The first node falls below half full and merges with the second one.
+  iter = list.Remove(++list.begin());
+  EXPECT_EQ(*iter, 4);
+  EXPECT_EQ(list.GetNodeCnt(), 2);
+
+  EXPECT_EQ(list.PopFront(), 0);
+  EXPECT_EQ(list.PopBack(), 10);
+  while (!list.IsEmpty()) {
+    list.PopBack();
+  }
+  EXPECT_EQ(list.GetNodeCnt(), 0);
+  list.PushBack(1);
+  EXPECT_EQ(list.GetFront(), 1);
+}
+
+TEST(UnrolledListTests, DestructElements) {
+  int32_t destruct_cnt = 0;
+  {
+    UnrolledList<Owned<Counter>, 2> list;
+    for (int32_t i = 0; i < 5; ++i) {
+      list.EmplaceFront(Owned<Counter>::New(&destruct_cnt));
+    }
+    list.Remove(list.begin());
+    EXPECT_EQ(destruct_cnt, 1);
+    const Owned<Counter> pop = list.PopBack();
+    EXPECT_EQ(destruct_cnt, 1);
+  }
+  EXPECT_EQ(destruct_cnt, 5);
+}
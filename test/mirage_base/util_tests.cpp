@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+
+#include "mirage_base/util/aligned_memory.hpp"
+#include "mirage_base/util/cache_line_padded.hpp"
 #include "mirage_base/util/hash.hpp"
 #include "mirage_base/util/optional.hpp"
 
@@ -55,3 +59,44 @@ TEST(UtilTests, MoveOptional) {
   EXPECT_TRUE(move_num.IsValid());
   EXPECT_EQ(move_num.Unwrap(), 1);
 }
+
+TEST(UtilTests, OverAlignedMemory) {
+  EXPECT_EQ(alignof(AlignedMemory<int32_t>), alignof(int32_t));
+  EXPECT_EQ(sizeof(AlignedMemory<int32_t>), sizeof(int32_t));
+  EXPECT_EQ((alignof(AlignedMemory<int32_t, 32>)), 32);
+  EXPECT_EQ((sizeof(AlignedMemory<int32_t, 32>)), 32);
+
+  AlignedMemory<int32_t, 64> mems[2];
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(mems[1].GetPtr()) % 64, 0);
+  AlignedMemory<int32_t, 64> mem(1);
+  EXPECT_EQ(mem.GetConstRef(), 1);
+}
+
+TEST(UtilTests, CacheLinePadded) {
+  EXPECT_EQ(sizeof(CacheLinePadded<int8_t>), kCacheLineSize);
+  EXPECT_EQ(alignof(CacheLinePadded<int8_t>), kCacheLineSize);
+
+  CacheLinePadded<int64_t> counters[4];
+  EXPECT_EQ(*counters[0], 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(&counters[1].Get()) -
+                reinterpret_cast<uintptr_t>(&counters[0].Get()),
+            kCacheLineSize);
+
+  std::thread threads[4];
+  for (size_t i = 0; i < 4; ++i) {
+    threads[i] = std::thread([&counter = counters[i]] {
+      for (int32_t j = 0; j < 1000; ++j) {
+        ++*counter;
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const CacheLinePadded<int64_t>& counter : counters) {
+    EXPECT_EQ(counter.Get(), 1000);
+  }
+
+  const CacheLinePadded<Optional<int32_t>> padded(Optional<int32_t>::New(1));
+  EXPECT_TRUE(padded->IsValid());
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mirage_base/container/array.hpp"
+#include "mirage_base/synchronize/wait_group.hpp"
+
+using namespace mirage::base;
+
+TEST(WaitGroupTests, Wait) {
+  constexpr int32_t kTaskCnt = 8;
+
+  WaitGroup group;
+  EXPECT_TRUE(group.WaitFor(std::chrono::milliseconds(1)));  // Empty.
+  std::atomic<int32_t> done_cnt = 0;
+  group.Add(kTaskCnt);
+  Array<std::thread> threads;
+  for (int32_t i = 0; i < kTaskCnt; ++i) {
+    threads.Emplace([&] {
+      done_cnt.fetch_add(1);
+      group.Done();
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(done_cnt.load(), kTaskCnt);
+  EXPECT_EQ(group.GetCnt(), 0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(WaitGroupTests, WaitFor) {
+  WaitGroup group;
+  group.Add();
+  EXPECT_FALSE(group.WaitFor(std::chrono::milliseconds(1)));
+  std::thread thread([&group] { group.Done(); });
+  EXPECT_TRUE(group.WaitFor(std::chrono::seconds(10)));
+  thread.join();
+}